@@ -0,0 +1,108 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+// Scaling of the relaxed priority queue against a mutex-guarded std::priority_queue, from 1 to N threads
+#include <abc/async/priority_queue.h>
+
+#include <benchmark/benchmark.h>
+#include <exec/inline_scheduler.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using abc::async::PriorityQueue;
+
+constexpr int max_threads = 32;
+
+// Items already queued when the benchmark starts, so that pops work on a deep heap
+constexpr std::int64_t prefill = 1 << 16;
+
+class LockedHeap
+{
+private:
+    std::mutex mutex_;
+    std::priority_queue<std::int64_t, std::vector<std::int64_t>, std::greater<>> heap_;
+
+public:
+    auto
+    push(std::int64_t const item) -> void
+    {
+        std::lock_guard lock{ mutex_ };
+        heap_.push(item);
+    }
+
+    auto
+    try_pop() -> std::optional<std::int64_t>
+    {
+        std::lock_guard lock{ mutex_ };
+        if (heap_.empty())
+        {
+            return std::nullopt;
+        }
+        std::int64_t const item = heap_.top();
+        heap_.pop();
+        return item;
+    }
+};
+
+// Every thread pushes an item with a pseudo-random key, then pops one, as a scheduler handing
+// deadlines between threads would
+template <typename QueueT>
+void
+run_push_pop(QueueT & queue, benchmark::State & state)
+{
+    if (state.thread_index() == 0)
+    {
+        static bool const filled = [&]() {
+            for (std::int64_t i = 0; i < prefill; ++i)
+            {
+                queue.push((i * 0x9E3779B97F4A7C15ll) & 0xFFFFFF);
+            }
+            return true;
+        }();
+        benchmark::DoNotOptimize(filled);
+    }
+
+    std::int64_t key = state.thread_index() + 1;
+    for (auto _ : state)
+    {
+        key = (key * 6364136223846793005ll + 1442695040888963407ll) & 0xFFFFFF;
+        queue.push(key);
+
+        std::optional<std::int64_t> item;
+        while (!(item = queue.try_pop()))
+        {
+            std::this_thread::yield();
+        }
+        benchmark::DoNotOptimize(item);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void
+bm_locked_heap(benchmark::State & state)
+{
+    static LockedHeap queue;
+    run_push_pop(queue, state);
+}
+
+void
+bm_relaxed_priority_queue(benchmark::State & state)
+{
+    static PriorityQueue<std::int64_t, exec::inline_scheduler> queue{ exec::inline_scheduler{}, 2 * max_threads };
+    run_push_pop(queue, state);
+}
+
+} // namespace
+
+BENCHMARK(bm_locked_heap)->ThreadRange(1, max_threads)->UseRealTime();
+BENCHMARK(bm_relaxed_priority_queue)->ThreadRange(1, max_threads)->UseRealTime();
@@ -0,0 +1,79 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+// Throughput of the async queue's synchronous operations under contention, per cell layout
+#include <abc/async/queue.h>
+
+#include <benchmark/benchmark.h>
+#include <exec/inline_scheduler.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <type_traits>
+
+namespace
+{
+
+using abc::async::Queue;
+using abc::async::QueueCardinality;
+using abc::async::QueueCellLayout;
+
+// A payload filling a whole cache line
+struct Payload64
+{
+    std::uint64_t words[8];
+};
+
+static_assert(sizeof(Payload64) == 64);
+
+template <typename T>
+auto
+make_item(std::int64_t const i) noexcept -> T
+{
+    if constexpr (std::is_same_v<T, Payload64>)
+    {
+        return Payload64{ { static_cast<std::uint64_t>(i) } };
+    }
+    else
+    {
+        return static_cast<T>(i);
+    }
+}
+
+// Every thread enqueues one item then dequeues one, so the queue never holds more items than
+// there are threads while producers and consumers keep hitting neighbouring cells.
+template <typename T, QueueCellLayout LayoutV>
+void
+bm_queue_enqueue_dequeue(benchmark::State & state)
+{
+    static Queue<T, 1024, exec::inline_scheduler, QueueCardinality::Mpmc, LayoutV> queue{ exec::inline_scheduler{} };
+
+    std::int64_t i = 0;
+    for (auto _ : state)
+    {
+        while (!queue.enqueue(make_item<T>(i)))
+        {
+            std::this_thread::yield();
+        }
+
+        std::optional<T> item;
+        while (!(item = queue.dequeue()))
+        {
+            std::this_thread::yield();
+        }
+        benchmark::DoNotOptimize(item);
+        ++i;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(bm_queue_enqueue_dequeue<int, QueueCellLayout::Packed>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(bm_queue_enqueue_dequeue<int, QueueCellLayout::Padded>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(bm_queue_enqueue_dequeue<int, QueueCellLayout::Remapped>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(bm_queue_enqueue_dequeue<Payload64, QueueCellLayout::Packed>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(bm_queue_enqueue_dequeue<Payload64, QueueCellLayout::Padded>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(bm_queue_enqueue_dequeue<Payload64, QueueCellLayout::Remapped>)->ThreadRange(1, 32)->UseRealTime();
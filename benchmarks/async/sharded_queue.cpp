@@ -0,0 +1,100 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+// Scaling of the sharded queue against a single shared ring, from 1 to N threads
+#include <abc/async/queue.h>
+#include <abc/async/sharded_queue.h>
+
+#include <benchmark/benchmark.h>
+#include <exec/inline_scheduler.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <thread>
+
+namespace
+{
+
+using abc::async::Queue;
+using abc::async::ShardedQueue;
+
+constexpr std::size_t total_capacity = 4096;
+constexpr int max_threads = 32;
+
+// Every thread enqueues one item then dequeues one, as in bm_queue_enqueue_dequeue
+template <typename QueueT>
+void
+run_enqueue_dequeue(QueueT & queue, benchmark::State & state)
+{
+    std::int64_t i = 0;
+    for (auto _ : state)
+    {
+        while (!queue.enqueue(i))
+        {
+            std::this_thread::yield();
+        }
+
+        std::optional<std::int64_t> item;
+        while (!(item = queue.dequeue()))
+        {
+            std::this_thread::yield();
+        }
+        benchmark::DoNotOptimize(item);
+        ++i;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void
+bm_single_ring(benchmark::State & state)
+{
+    static Queue<std::int64_t, total_capacity, exec::inline_scheduler> queue{ exec::inline_scheduler{} };
+    run_enqueue_dequeue(queue, state);
+}
+
+void
+bm_sharded(benchmark::State & state)
+{
+    // One shard per benchmark thread at the largest thread count
+    static ShardedQueue<std::int64_t, total_capacity / max_threads, exec::inline_scheduler> queue{ exec::inline_scheduler{}, max_threads };
+    run_enqueue_dequeue(queue, state);
+}
+
+// Producers and consumers are separate threads, so consumers have to steal
+void
+bm_sharded_split_roles(benchmark::State & state)
+{
+    static ShardedQueue<std::int64_t, total_capacity / max_threads, exec::inline_scheduler> queue{ exec::inline_scheduler{}, max_threads };
+
+    std::int64_t i = 0;
+    bool const producer = state.thread_index() % 2 == 0;
+    for (auto _ : state)
+    {
+        if (producer)
+        {
+            while (!queue.enqueue(i))
+            {
+                std::this_thread::yield();
+            }
+        }
+        else
+        {
+            std::optional<std::int64_t> item;
+            while (!(item = queue.dequeue()))
+            {
+                std::this_thread::yield();
+            }
+            benchmark::DoNotOptimize(item);
+        }
+        ++i;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(bm_single_ring)->ThreadRange(1, max_threads)->UseRealTime();
+BENCHMARK(bm_sharded)->ThreadRange(1, max_threads)->UseRealTime();
+BENCHMARK(bm_sharded_split_roles)->ThreadRange(2, max_threads)->UseRealTime();
@@ -0,0 +1,201 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+// Passing 8-byte items and small messages to a forked consumer process: shared-memory rings
+// against a pipe
+#include <abc/details/config.h>
+
+#if defined(ABC_OS_LINUX)
+
+#include <abc/async/shared_byte_ring.h>
+#include <abc/async/shared_queue.h>
+#include <abc/shared_memory.h>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+
+using abc::SharedMemory;
+using abc::async::QueueCardinality;
+using abc::async::SharedByteRing;
+using abc::async::SharedQueue;
+
+constexpr std::int64_t end_of_stream = -1;
+constexpr std::size_t message_size = 64;
+
+// Forks a consumer running `body` to completion
+template <typename F>
+auto
+spawn(F && body) -> pid_t
+{
+    pid_t const pid = ::fork();
+    if (pid == 0)
+    {
+        body();
+        ::_exit(0);
+    }
+    return pid;
+}
+
+auto
+read_fully(int const fd, void * data, std::size_t const size) -> bool
+{
+    auto * bytes = static_cast<char *>(data);
+    for (std::size_t done = 0; done < size;)
+    {
+        ssize_t const n = ::read(fd, bytes + done, size - done);
+        if (n <= 0)
+        {
+            return false;
+        }
+        done += static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+void
+bm_pipe(benchmark::State & state)
+{
+    int fds[2];
+    if (::pipe(fds) != 0)
+    {
+        state.SkipWithError("pipe failed");
+        return;
+    }
+
+    pid_t const consumer = spawn([&fds]() {
+        ::close(fds[1]);
+        std::int64_t item = 0;
+        while (read_fully(fds[0], &item, sizeof(item)) && item != end_of_stream)
+        {
+            benchmark::DoNotOptimize(item);
+        }
+    });
+    ::close(fds[0]);
+
+    std::int64_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(::write(fds[1], &i, sizeof(i)));
+        ++i;
+    }
+
+    benchmark::DoNotOptimize(::write(fds[1], &end_of_stream, sizeof(end_of_stream)));
+    ::close(fds[1]);
+    ::waitpid(consumer, nullptr, 0);
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <QueueCardinality CardinalityV>
+void
+bm_shared_queue(benchmark::State & state)
+{
+    using queue_type = SharedQueue<std::int64_t, 4096, CardinalityV>;
+
+    auto memory = SharedMemory::anonymous(queue_type::required_size());
+    auto queue = queue_type::create(memory);
+
+    pid_t const consumer = spawn([&memory]() {
+        auto child = queue_type::attach(memory);
+        for (std::int64_t item = 0; (item = child.dequeue_blocking()) != end_of_stream;)
+        {
+            benchmark::DoNotOptimize(item);
+        }
+    });
+
+    std::int64_t i = 0;
+    for (auto _ : state)
+    {
+        queue.enqueue_blocking(i);
+        ++i;
+    }
+
+    queue.enqueue_blocking(end_of_stream);
+    ::waitpid(consumer, nullptr, 0);
+    state.SetItemsProcessed(state.iterations());
+}
+
+void
+bm_pipe_messages(benchmark::State & state)
+{
+    int fds[2];
+    if (::pipe(fds) != 0)
+    {
+        state.SkipWithError("pipe failed");
+        return;
+    }
+
+    pid_t const consumer = spawn([&fds]() {
+        ::close(fds[1]);
+        std::array<abc::byte_t, message_size> message{};
+        while (read_fully(fds[0], message.data(), message.size()) && message[0] != 0xff)
+        {
+            benchmark::DoNotOptimize(message);
+        }
+    });
+    ::close(fds[0]);
+
+    std::array<abc::byte_t, message_size> message{};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(::write(fds[1], message.data(), message.size()));
+    }
+
+    message[0] = 0xff;
+    benchmark::DoNotOptimize(::write(fds[1], message.data(), message.size()));
+    ::close(fds[1]);
+    ::waitpid(consumer, nullptr, 0);
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(message_size));
+}
+
+void
+bm_shared_byte_ring(benchmark::State & state)
+{
+    using ring_type = SharedByteRing<64 * 1024, QueueCardinality::Spsc>;
+
+    auto memory = SharedMemory::anonymous(ring_type::required_size());
+    auto ring = ring_type::create(memory);
+
+    pid_t const consumer = spawn([&memory]() {
+        auto child = ring_type::attach(memory);
+        while (true)
+        {
+            auto const message = child.read_blocking();
+            bool const last = message[0] == 0xff;
+            benchmark::DoNotOptimize(message.data());
+            child.commit_read();
+            if (last)
+            {
+                break;
+            }
+        }
+    });
+
+    std::array<abc::byte_t, message_size> message{};
+    for (auto _ : state)
+    {
+        ring.write_blocking(message);
+    }
+
+    message[0] = 0xff;
+    ring.write_blocking(message);
+    ::waitpid(consumer, nullptr, 0);
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(message_size));
+}
+
+} // namespace
+
+BENCHMARK(bm_pipe)->UseRealTime();
+BENCHMARK(bm_shared_queue<QueueCardinality::Spsc>)->UseRealTime();
+BENCHMARK(bm_shared_queue<QueueCardinality::Mpmc>)->UseRealTime();
+BENCHMARK(bm_pipe_messages)->UseRealTime();
+BENCHMARK(bm_shared_byte_ring)->UseRealTime();
+
+#endif // ABC_OS_LINUX
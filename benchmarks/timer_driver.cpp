@@ -0,0 +1,112 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & abc contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+// Request threads arming a timeout and cancelling it once the response arrives, from 1 to N threads,
+// and how late timers fire at millisecond and microsecond wheel resolution
+#include <abc/timer_driver.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using namespace std::chrono_literals;
+
+constexpr int max_threads = 32;
+
+// One driver reaped on its own thread, shared by every benchmark thread
+struct driver_fixture
+{
+    asio::io_context io_context;
+    asio::executor_work_guard<asio::io_context::executor_type> work{ io_context.get_executor() };
+    std::shared_ptr<abc::timer_driver> driver{ std::make_shared<abc::timer_driver>(&io_context, 1ms) };
+    std::thread reaper;
+
+    driver_fixture()
+    {
+        driver->start();
+        reaper = std::thread{ [this] { io_context.run(); } };
+    }
+
+    ~driver_fixture()
+    {
+        driver->stop();
+        work.reset();
+        reaper.join();
+    }
+};
+
+void
+bm_schedule_cancel(benchmark::State & state)
+{
+    static driver_fixture fixture;
+
+    for (auto _ : state)
+    {
+        auto const handle = fixture.driver->schedule(30s, [](std::error_code const &) {});
+        benchmark::DoNotOptimize(fixture.driver->cancel(handle));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Fire-time error (actual minus requested fire time) of timers due 50 us to 2 ms ahead, with the
+// wheel resolution in microseconds as the argument. Reports the error percentiles in microseconds.
+void
+bm_fire_jitter(benchmark::State & state)
+{
+    constexpr int timers_per_batch = 64;
+
+    asio::io_context io_context;
+    auto driver = std::make_shared<abc::timer_driver>(&io_context, 100ms, std::chrono::microseconds{ state.range(0) });
+    driver->start();
+
+    std::mt19937 rng{ 25 };
+    std::uniform_int_distribution<int> delay_us{ 50, 2000 };
+    std::vector<std::chrono::nanoseconds> errors;
+    for (auto _ : state)
+    {
+        int fired = 0;
+        for (int i = 0; i < timers_per_batch; ++i)
+        {
+            auto const delay = std::chrono::microseconds{ delay_us(rng) };
+            auto const due = std::chrono::steady_clock::now() + delay;
+            driver->schedule(delay, [&errors, &fired, due](std::error_code const &) {
+                errors.push_back(std::chrono::steady_clock::now() - due);
+                ++fired;
+            });
+        }
+
+        while (fired != timers_per_batch)
+        {
+            io_context.run_one();
+        }
+    }
+    driver->stop();
+    io_context.run_for(200ms);
+
+    std::sort(errors.begin(), errors.end());
+    auto const percentile = [&errors](double const p) {
+        auto const index = std::min(errors.size() - 1, static_cast<std::size_t>(p * static_cast<double>(errors.size())));
+        return std::chrono::duration<double, std::micro>(errors[index]).count();
+    };
+    state.counters["p50_us"] = percentile(0.50);
+    state.counters["p99_us"] = percentile(0.99);
+    state.counters["p999_us"] = percentile(0.999);
+    state.counters["max_us"] = std::chrono::duration<double, std::micro>(errors.back()).count();
+    state.SetItemsProcessed(static_cast<std::int64_t>(errors.size()));
+}
+
+} // namespace
+
+BENCHMARK(bm_schedule_cancel)->ThreadRange(1, max_threads)->UseRealTime();
+BENCHMARK(bm_fire_jitter)->Arg(1000)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
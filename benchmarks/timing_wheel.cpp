@@ -0,0 +1,119 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & abc contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+// Reaping up to 10^6 timers: the hierarchical timing wheel against the vector scan timer_driver used before it
+#include <abc/timing_wheel.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace
+{
+
+// Deadlines spread over one second of one millisecond ticks, reaped every 10 ms like timer_driver does
+constexpr std::uint64_t window = 1000;
+constexpr std::uint64_t reap_interval = 10;
+
+auto
+deadline_of(std::int64_t const i) -> std::uint64_t
+{
+    return 1 + (static_cast<std::uint64_t>(i) * 0x9E3779B97F4A7C15ull >> 32) % window;
+}
+
+struct wheel_timer : abc::timing_wheel_node
+{
+    std::function<void()> callback;
+};
+
+void
+bm_vector_scan(benchmark::State & state)
+{
+    struct scanned_timer
+    {
+        std::uint64_t deadline;
+        std::function<void()> callback;
+    };
+
+    std::int64_t const timer_count = state.range(0);
+    std::int64_t fired = 0;
+    for (auto _ : state)
+    {
+        std::vector<scanned_timer> timers;
+        for (std::int64_t i = 0; i < timer_count; ++i)
+        {
+            timers.push_back({ deadline_of(i), [&fired] { ++fired; } });
+        }
+
+        for (std::uint64_t now = reap_interval; now <= window; now += reap_interval)
+        {
+            // Every reap walks all pending timers; erase_if keeps it linear per reap
+            std::erase_if(timers, [now](scanned_timer & timer) {
+                if (timer.deadline > now)
+                {
+                    return false;
+                }
+                timer.callback();
+                return true;
+            });
+        }
+    }
+
+    benchmark::DoNotOptimize(fired);
+    state.SetItemsProcessed(state.iterations() * timer_count);
+}
+
+void
+bm_timing_wheel(benchmark::State & state)
+{
+    std::int64_t const timer_count = state.range(0);
+    std::vector<wheel_timer> timers(static_cast<std::size_t>(timer_count));
+    std::int64_t fired = 0;
+    for (auto _ : state)
+    {
+        abc::timing_wheel wheel;
+        for (std::int64_t i = 0; i < timer_count; ++i)
+        {
+            timers[i].callback = [&fired] { ++fired; };
+            wheel.insert(&timers[i], deadline_of(i));
+        }
+
+        for (std::uint64_t now = reap_interval; now <= window; now += reap_interval)
+        {
+            wheel.advance(now, [](abc::timing_wheel_node * node) { static_cast<wheel_timer *>(node)->callback(); });
+        }
+    }
+
+    benchmark::DoNotOptimize(fired);
+    state.SetItemsProcessed(state.iterations() * timer_count);
+}
+
+// Timeouts that are almost always cancelled before they fire, as request timeouts are
+void
+bm_timing_wheel_insert_erase(benchmark::State & state)
+{
+    std::int64_t const timer_count = state.range(0);
+    std::vector<wheel_timer> timers(static_cast<std::size_t>(timer_count));
+    abc::timing_wheel wheel;
+    for (auto _ : state)
+    {
+        for (std::int64_t i = 0; i < timer_count; ++i)
+        {
+            wheel.insert(&timers[i], deadline_of(i));
+        }
+        for (std::int64_t i = 0; i < timer_count; ++i)
+        {
+            wheel.erase(&timers[i]);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * timer_count);
+}
+
+} // namespace
+
+BENCHMARK(bm_vector_scan)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_timing_wheel)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_timing_wheel_insert_erase)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
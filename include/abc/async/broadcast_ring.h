@@ -0,0 +1,410 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_BROADCAST_RING
+#define ABC_INCLUDE_ABC_ASYNC_BROADCAST_RING
+
+#pragma once
+
+#include "broadcast_ring_decl.h"
+
+#include "abc/error.h"
+#include "abc/scope_guard.h"
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace abc::async
+{
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::Consumer::Consumer(BroadcastRing const * ring, std::initializer_list<Consumer *> upstream) : ring_{ ring }, upstream_(upstream.begin(), upstream.end())
+{
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+bool
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::Consumer::readable() const noexcept
+{
+    return ring_->available_for(*this) > sequence_.load(std::memory_order_relaxed);
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+std::size_t
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::Consumer::sequence() const noexcept
+{
+    return sequence_.load(std::memory_order_acquire);
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::BroadcastRing(Scheduler scheduler) : scheduler_{ scheduler }
+{
+    static_assert(Capacity > 0, "Broadcast ring capacity must be greater than 0");
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::~BroadcastRing()
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        // Every slot ever written still holds its last item
+        std::size_t const claimed = claimed_.load(std::memory_order_acquire);
+        for (std::size_t sequence = claimed - std::min(claimed, capacity()); sequence != claimed; ++sequence)
+        {
+            std::destroy_at(&item_at(sequence));
+        }
+    }
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+typename BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::Slot &
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::slot_at(std::size_t const sequence) noexcept
+{
+    return buffer_[sequence & (capacity() - 1)];
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+typename BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::Slot const &
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::slot_at(std::size_t const sequence) const noexcept
+{
+    return buffer_[sequence & (capacity() - 1)];
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+T const &
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::item_at(std::size_t const sequence) const noexcept
+{
+    return *std::launder(reinterpret_cast<T const *>(slot_at(sequence).storage));
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+std::size_t
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::minimum_sequence() const noexcept
+{
+    if (consumers_.empty())
+    {
+        if constexpr (multi_producer)
+        {
+            // Nobody reads, but a slot may only be reused once the item it holds is published:
+            // a producer preempted while constructing must not be lapped by the others
+            return published_bound(gating_cache_.load(std::memory_order_acquire));
+        }
+        else
+        {
+            // The only producer has published everything it claimed
+            return claimed_.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::size_t minimum = std::numeric_limits<std::size_t>::max();
+    for (auto const & consumer : consumers_)
+    {
+        minimum = std::min(minimum, consumer->sequence_.load(std::memory_order_acquire));
+    }
+    return minimum;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+std::size_t
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::published_bound(std::size_t from) const noexcept
+{
+    if constexpr (multi_producer)
+    {
+        std::size_t const claimed = claimed_.load(std::memory_order_acquire);
+        while (from != claimed && std::atomic_ref<std::size_t>{ slot_at(from).published }.load(std::memory_order_acquire) == from + 1)
+        {
+            ++from;
+        }
+        return from;
+    }
+    else
+    {
+        return published_.load(std::memory_order_acquire);
+    }
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+std::size_t
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::available_for(Consumer const & consumer) const noexcept
+{
+    if (consumer.upstream_.empty())
+    {
+        return published_bound(consumer.sequence_.load(std::memory_order_relaxed));
+    }
+
+    // Upstream cursors never pass the published bound
+    std::size_t bound = std::numeric_limits<std::size_t>::max();
+    for (Consumer const * upstream : consumer.upstream_)
+    {
+        bound = std::min(bound, upstream->sequence_.load(std::memory_order_acquire));
+    }
+    return bound;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+bool
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::can_publish() const noexcept
+{
+    return claimed_.load(std::memory_order_relaxed) < minimum_sequence() + capacity();
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+bool
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::claim(std::size_t & sequence) noexcept
+{
+    std::size_t next = claimed_.load(std::memory_order_relaxed);
+    while (true)
+    {
+        // The gating cursor is re-read only when the cached one says the ring is full. The
+        // acquire/release pair hands the consumers' reads of the old item on to whichever
+        // producer overwrites it.
+        if (next >= gating_cache_.load(std::memory_order_acquire) + capacity())
+        {
+            std::size_t const gating = minimum_sequence();
+            gating_cache_.store(gating, std::memory_order_release);
+            if (next >= gating + capacity())
+            {
+                return false;
+            }
+        }
+
+        if constexpr (multi_producer)
+        {
+            if (claimed_.compare_exchange_weak(next, next + 1, std::memory_order_relaxed, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else
+        {
+            claimed_.store(next + 1, std::memory_order_relaxed);
+            break;
+        }
+    }
+
+    sequence = next;
+    return true;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+void
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::commit(std::size_t const sequence) noexcept
+{
+    if constexpr (multi_producer)
+    {
+        std::atomic_ref<std::size_t>{ slot_at(sequence).published }.store(sequence + 1, std::memory_order_release);
+    }
+    else
+    {
+        published_.store(sequence + 1, std::memory_order_release);
+    }
+
+    if constexpr (WaitV == BroadcastWaitStrategy::Park)
+    {
+        for (auto const & consumer : consumers_)
+        {
+            if (consumer->upstream_.empty())
+            {
+                consumer->waiters_.notify_one();
+            }
+        }
+    }
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+template <typename Writer>
+auto
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::do_publish(Writer && writer) -> bool
+{
+    std::size_t sequence;
+    if (!claim(sequence))
+    {
+        return false;
+    }
+
+    // Every consumer has read the item the slot held one lap ago
+    T * slot = reinterpret_cast<T *>(slot_at(sequence).storage);
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        if (sequence >= capacity())
+        {
+            std::destroy_at(std::launder(slot));
+        }
+    }
+
+    writer(slot);
+    commit(sequence);
+    return true;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+auto
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::add_consumer(std::initializer_list<Consumer *> upstream) -> Consumer &
+{
+    if (claimed_.load(std::memory_order_relaxed) != 0)
+    {
+        throw_error(make_error_code(errc::consumer_added_after_publish));
+    }
+
+    consumers_.push_back(std::unique_ptr<Consumer>(new Consumer{ this, upstream }));
+    Consumer * consumer = consumers_.back().get();
+    for (Consumer * stage : upstream)
+    {
+        assert(stage->ring_ == this);
+        stage->downstream_.push_back(consumer);
+    }
+    return *consumer;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+template <typename... Args>
+bool
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::try_emplace(Args &&... args)
+{
+    if constexpr (std::is_nothrow_constructible_v<T, Args &&...>)
+    {
+        return do_publish([&](T * slot) noexcept { std::construct_at(slot, std::forward<Args>(args)...); });
+    }
+    else
+    {
+        // A claimed slot cannot be handed back, so a constructor that may throw runs before claiming
+        static_assert(std::is_nothrow_move_constructible_v<T>, "try_emplace requires a non-throwing constructor from the arguments or a non-throwing move constructor");
+        T item(std::forward<Args>(args)...);
+        return do_publish([&item](T * slot) noexcept { std::construct_at(slot, std::move(item)); });
+    }
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+bool
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::try_publish(T && item)
+{
+    return try_emplace(std::move(item));
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+bool
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::try_publish(T const & item)
+{
+    return try_emplace(item);
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+template <typename F>
+std::size_t
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::read(Consumer & consumer, F && reader, std::size_t const max)
+{
+    assert(consumer.ring_ == this);
+
+    std::size_t const first = consumer.sequence_.load(std::memory_order_relaxed);
+    std::size_t const last = first + std::min(available_for(consumer) - first, max);
+    if (first == last)
+    {
+        return 0;
+    }
+
+    // Items the reader has seen are released even if it throws
+    std::size_t next = first;
+    auto release = make_scope_exit([this, &consumer, &next]() noexcept {
+        consumer.sequence_.store(next, std::memory_order_release);
+        if constexpr (WaitV == BroadcastWaitStrategy::Park)
+        {
+            for (Consumer * downstream : consumer.downstream_)
+            {
+                downstream->waiters_.notify_one();
+            }
+            producers_.notify_all();
+        }
+    });
+
+    while (next != last)
+    {
+        T const & item = item_at(next++);
+        std::invoke(reader, item);
+    }
+    return last - first;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+auto
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::wait_readable(Consumer & consumer) -> exec::task<void>
+{
+    if constexpr (WaitV == BroadcastWaitStrategy::Park)
+    {
+        co_await details::ParkAwaiter<Consumer, Scheduler>{ scheduler_, consumer.waiters_, &consumer, &Consumer::readable };
+    }
+    else
+    {
+        co_await stdexec::schedule(scheduler_);
+    }
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+auto
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::wait_writable() -> exec::task<void>
+{
+    if constexpr (WaitV == BroadcastWaitStrategy::Park)
+    {
+        co_await details::ParkAwaiter<BroadcastRing, Scheduler>{ scheduler_, producers_, this, &BroadcastRing::can_publish };
+    }
+    else
+    {
+        co_await stdexec::schedule(scheduler_);
+    }
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+auto
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::async_publish(T item) -> exec::task<void>
+{
+    while (true)
+    {
+        if (try_publish(std::move(item)))
+        {
+            co_return;
+        }
+
+        // The slowest consumer is a whole lap behind, wait for it and retry
+        co_await wait_writable();
+    }
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+template <typename F>
+auto
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::async_read(Consumer & consumer, F reader, std::size_t const max) -> exec::task<std::size_t>
+{
+    while (true)
+    {
+        std::size_t const count = read(consumer, reader, max);
+        if (count > 0)
+        {
+            co_return count;
+        }
+
+        // Nothing published (or nothing passed by the upstream stages) yet
+        co_await wait_readable(consumer);
+    }
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+std::size_t
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::claimed() const noexcept
+{
+    return claimed_.load(std::memory_order_acquire);
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+constexpr std::size_t
+BroadcastRing<T, Capacity, Scheduler, ProducersV, WaitV>::capacity() const noexcept
+{
+    return Capacity;
+}
+
+} // namespace abc::async
+
+#endif // ABC_INCLUDE_ABC_ASYNC_BROADCAST_RING
@@ -0,0 +1,196 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_BROADCAST_RING_DECL
+#define ABC_INCLUDE_ABC_ASYNC_BROADCAST_RING_DECL
+
+#pragma once
+
+#include "abc/byte.h"
+#include "broadcast_ring_fwd_decl.h"
+
+#include "details/park_awaiter.h"
+#include "details/ring_storage.h"
+#include "details/waiter_list.h"
+
+#include <exec/task.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace abc::async
+{
+
+// Disruptor-style ring delivering every item to every consumer. Items are constructed once in
+// a slot and read in place; no consumer owns or moves them.
+//
+// Every consumer has its own cursor, the number of items it has read. A consumer may name
+// upstream consumers: it then only sees items all of them have read, which chains stages into
+// a pipeline or a diamond. Producers claim sequence numbers and cannot lap the slowest consumer;
+// the item previously in a slot is destroyed when the slot is reused.
+//
+// With a single producer, publishing is a plain store of the published count. With multiple
+// producers, sequences are claimed with a CAS and every slot carries the sequence of its item,
+// so items published out of order only become visible once the gap is filled.
+//
+// Consumers are registered before the first publish, and each consumer is used by one thread
+// or coroutine at a time. A ring without consumers never applies back-pressure: old items are
+// overwritten as soon as the ring wraps, though with multiple producers a slot is only reused
+// once the item it holds has been published.
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, ProducerCardinality ProducersV, BroadcastWaitStrategy WaitV>
+class BroadcastRing
+{
+public:
+    class Consumer;
+
+private:
+    static constexpr bool multi_producer = ProducersV == ProducerCardinality::Multi;
+    static constexpr std::size_t cache_line_size_in_bytes = 64; // Assuming 64-byte cache line size
+
+    // Multi-producer slots remember which sequence they hold (plus one, so that the
+    // zero-initialized state means "nothing published"), accessed through std::atomic_ref.
+    struct SequencedSlot
+    {
+        mutable std::size_t published;
+        alignas(T) byte_t storage[sizeof(T)];
+    };
+
+    struct PlainSlot
+    {
+        alignas(T) byte_t storage[sizeof(T)];
+    };
+
+    using Slot = std::conditional_t<multi_producer, SequencedSlot, PlainSlot>;
+
+    details::RingStorage<Slot, Capacity> buffer_;
+
+    // Next sequence to claim
+    alignas(cache_line_size_in_bytes) std::atomic<std::size_t> claimed_{ 0 };
+
+    // Producer-side copy of the slowest consumer's cursor, refreshed only when the ring looks full
+    std::atomic<std::size_t> gating_cache_{ 0 };
+
+    // Single producer only: number of published items
+    alignas(cache_line_size_in_bytes) std::atomic<std::size_t> published_{ 0 };
+
+    // Suspended producers, waiting for the slowest consumer to free a slot
+    alignas(cache_line_size_in_bytes) details::WaiterList producers_;
+
+    std::vector<std::unique_ptr<Consumer>> consumers_;
+    Scheduler scheduler_;
+
+    auto slot_at(std::size_t sequence) noexcept -> Slot &;
+    auto slot_at(std::size_t sequence) const noexcept -> Slot const &;
+    auto item_at(std::size_t sequence) const noexcept -> T const &;
+
+    // Cursor of the slowest consumer, or the first unpublished sequence when there is none;
+    // every slot holding a sequence below it is free for reuse
+    auto minimum_sequence() const noexcept -> std::size_t;
+
+    // First sequence at or after `from` that is not published yet
+    auto published_bound(std::size_t from) const noexcept -> std::size_t;
+
+    // First sequence `consumer` may not read yet
+    auto available_for(Consumer const & consumer) const noexcept -> std::size_t;
+
+    auto can_publish() const noexcept -> bool;
+
+    // Claims the next sequence, or returns false when that would lap the slowest consumer
+    auto claim(std::size_t & sequence) noexcept -> bool;
+
+    // Makes `sequence` visible and wakes the consumers waiting for it
+    auto commit(std::size_t sequence) noexcept -> void;
+
+    // Claim, construct the item through `writer(slot)` and publish. Writers must not throw.
+    template <typename Writer>
+    auto do_publish(Writer && writer) -> bool;
+
+    // Wait for `consumer` to have something to read / for a free slot, as selected by `WaitV`
+    auto wait_readable(Consumer & consumer) -> exec::task<void>;
+    auto wait_writable() -> exec::task<void>;
+
+public:
+    static constexpr std::size_t no_limit = std::numeric_limits<std::size_t>::max();
+
+    // Cursor of one consumer, owned by the ring
+    class Consumer
+    {
+    private:
+        friend BroadcastRing;
+
+        BroadcastRing const * ring_;
+
+        // Number of items read, i.e. the next sequence to read
+        alignas(cache_line_size_in_bytes) std::atomic<std::size_t> sequence_{ 0 };
+
+        std::vector<Consumer const *> upstream_;
+        std::vector<Consumer *> downstream_;
+
+        // The consumer's coroutine, suspended until there is something to read
+        details::WaiterList waiters_;
+
+        Consumer(BroadcastRing const * ring, std::initializer_list<Consumer *> upstream);
+
+        auto readable() const noexcept -> bool;
+
+    public:
+        Consumer(Consumer const &) = delete;
+        auto operator=(Consumer const &) -> Consumer & = delete;
+        Consumer(Consumer &&) = delete;
+        auto operator=(Consumer &&) -> Consumer & = delete;
+        ~Consumer() = default;
+
+        // Number of items this consumer has read
+        auto sequence() const noexcept -> std::size_t;
+    };
+
+    explicit BroadcastRing(Scheduler scheduler);
+
+    // Non-copyable, non-movable
+    BroadcastRing(BroadcastRing const &) = delete;
+    auto operator=(BroadcastRing const &) -> BroadcastRing & = delete;
+    BroadcastRing(BroadcastRing &&) = delete;
+    auto operator=(BroadcastRing &&) -> BroadcastRing & = delete;
+    ~BroadcastRing();
+
+    // Registers a consumer that reads an item only after every `upstream` consumer has read it.
+    // Throws abc_error(errc::consumer_added_after_publish) once anything has been published.
+    auto add_consumer(std::initializer_list<Consumer *> upstream = {}) -> Consumer &;
+
+    // Constructs the next item in place. Returns false, without constructing, when publishing
+    // would overwrite an item the slowest consumer has not read yet. T must be nothrow
+    // constructible from `args`, or nothrow move constructible: then the item is built before a
+    // sequence is claimed, and moved in.
+    template <typename... Args>
+    auto try_emplace(Args &&... args) -> bool;
+
+    auto try_publish(T && item) -> bool;
+    auto try_publish(T const & item) -> bool;
+
+    // Publishes `item`, waiting for the slowest consumer while the ring is full
+    auto async_publish(T item) -> exec::task<void>;
+
+    // Invokes `reader(T const &)` on up to `max` items `consumer` may read, in order, then moves
+    // its cursor past them. Returns the number of items read, 0 when there is nothing to read.
+    // An item counts as read even if `reader` throws on it.
+    template <typename F>
+    auto read(Consumer & consumer, F && reader, std::size_t max = no_limit) -> std::size_t;
+
+    // read() waiting until at least one item is available. `reader` is kept in the coroutine frame.
+    template <typename F>
+    auto async_read(Consumer & consumer, F reader, std::size_t max = no_limit) -> exec::task<std::size_t>;
+
+    // Number of items published so far (claimed, for multiple producers)
+    auto claimed() const noexcept -> std::size_t;
+
+    constexpr auto capacity() const noexcept -> std::size_t;
+};
+
+} // namespace abc::async
+
+#endif // ABC_INCLUDE_ABC_ASYNC_BROADCAST_RING_DECL
@@ -0,0 +1,39 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_BROADCAST_RING_FWD_DECL
+#define ABC_INCLUDE_ABC_ASYNC_BROADCAST_RING_FWD_DECL
+
+#pragma once
+
+#include <stdexec/execution.hpp>
+
+#include <cstddef>
+
+namespace abc::async
+{
+
+// Number of threads allowed to publish into a broadcast ring
+enum class ProducerCardinality
+{
+    Single,
+    Multi,
+};
+
+// How an async operation of a broadcast ring waits for progress
+enum class BroadcastWaitStrategy
+{
+    Park,  // suspend on a waiter list until notified, resumed through the scheduler
+    Yield, // reschedule through the scheduler and retry, lower latency for busy stages
+};
+
+template <typename T,
+          std::size_t Capacity,
+          stdexec::scheduler Scheduler,
+          ProducerCardinality ProducersV = ProducerCardinality::Single,
+          BroadcastWaitStrategy WaitV = BroadcastWaitStrategy::Park>
+class BroadcastRing;
+
+}
+
+#endif // ABC_INCLUDE_ABC_ASYNC_BROADCAST_RING_FWD_DECL
@@ -0,0 +1,159 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_BYTE_RING
+#define ABC_INCLUDE_ABC_ASYNC_BYTE_RING
+
+#pragma once
+
+#include "byte_ring_decl.h"
+
+#include "abc/bytes_view.h"
+
+#include <cstring>
+
+namespace abc::async
+{
+
+template <std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+bool
+ByteRing<Capacity, Scheduler, CardinalityV>::SpaceWait::ready() const noexcept
+{
+    return ring->records_.fits(length);
+}
+
+template <std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+ByteRing<Capacity, Scheduler, CardinalityV>::ByteRing(Scheduler scheduler) : scheduler_{ scheduler }
+{
+}
+
+template <std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+bool
+ByteRing<Capacity, Scheduler, CardinalityV>::can_read() const noexcept
+{
+    return records_.readable(reading_);
+}
+
+template <std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+auto
+ByteRing<Capacity, Scheduler, CardinalityV>::try_reserve(std::size_t const size) -> std::optional<std::span<byte_t>>
+{
+    return records_.try_reserve(size);
+}
+
+template <std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+void
+ByteRing<Capacity, Scheduler, CardinalityV>::commit(std::span<byte_t> const reserved) noexcept
+{
+    records_.commit(reserved);
+    consumers_.notify_one();
+}
+
+template <std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+bool
+ByteRing<Capacity, Scheduler, CardinalityV>::try_write(std::span<byte_t const> const message)
+{
+    auto reserved = try_reserve(message.size());
+    if (!reserved)
+    {
+        return false;
+    }
+
+    std::memcpy(reserved->data(), message.data(), message.size());
+    commit(*reserved);
+    return true;
+}
+
+template <std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+auto
+ByteRing<Capacity, Scheduler, CardinalityV>::async_reserve(std::size_t const size) -> exec::task<std::span<byte_t>>
+{
+    while (true)
+    {
+        if (auto reserved = try_reserve(size))
+        {
+            co_return *reserved;
+        }
+
+        // Not enough space, park until the consumer has freed enough for this record and retry
+        SpaceWait const wait{ this, Records::record_length(size) };
+        co_await details::ParkAwaiter<SpaceWait, Scheduler>{ scheduler_, producers_, &wait, &SpaceWait::ready };
+    }
+}
+
+template <std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+auto
+ByteRing<Capacity, Scheduler, CardinalityV>::async_write(std::span<byte_t const> const message) -> exec::task<void>
+{
+    std::span<byte_t> const reserved = co_await async_reserve(message.size());
+    std::memcpy(reserved.data(), message.data(), message.size());
+    commit(reserved);
+}
+
+template <std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+auto
+ByteRing<Capacity, Scheduler, CardinalityV>::try_read() -> std::optional<bytes_view<ByteNumbering::None>>
+{
+    return records_.try_read(reading_);
+}
+
+template <std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+void
+ByteRing<Capacity, Scheduler, CardinalityV>::commit_read() noexcept
+{
+    if (reading_ == 0)
+    {
+        return;
+    }
+
+    records_.commit_read(reading_);
+    producers_.notify_all();
+}
+
+template <std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+auto
+ByteRing<Capacity, Scheduler, CardinalityV>::async_read() -> exec::task<bytes_view<ByteNumbering::None>>
+{
+    while (true)
+    {
+        if (auto message = try_read())
+        {
+            co_return *message;
+        }
+
+        // Nothing committed yet, park until a producer commits a message and retry
+        co_await details::ParkAwaiter<ByteRing, Scheduler>{ scheduler_, consumers_, this, &ByteRing::can_read };
+    }
+}
+
+template <std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+bool
+ByteRing<Capacity, Scheduler, CardinalityV>::empty() const noexcept
+{
+    return size() == 0;
+}
+
+template <std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+std::size_t
+ByteRing<Capacity, Scheduler, CardinalityV>::size() const noexcept
+{
+    return records_.size();
+}
+
+template <std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+constexpr std::size_t
+ByteRing<Capacity, Scheduler, CardinalityV>::capacity() const noexcept
+{
+    return Capacity;
+}
+
+template <std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+constexpr std::size_t
+ByteRing<Capacity, Scheduler, CardinalityV>::max_message_size() const noexcept
+{
+    return Records::max_message_size;
+}
+
+} // namespace abc::async
+
+#endif // ABC_INCLUDE_ABC_ASYNC_BYTE_RING
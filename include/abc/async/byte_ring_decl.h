@@ -0,0 +1,119 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_BYTE_RING_DECL
+#define ABC_INCLUDE_ABC_ASYNC_BYTE_RING_DECL
+
+#pragma once
+
+#include "abc/byte.h"
+#include "abc/bytes_view_decl.h"
+#include "byte_ring_fwd_decl.h"
+
+#include "details/byte_records.h"
+#include "details/park_awaiter.h"
+#include "details/ring_storage.h"
+#include "details/waiter_list.h"
+
+#include <exec/task.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+namespace abc::async
+{
+
+// Ring of variable-length messages stored inline, for zero-allocation, zero-copy message passing.
+//
+// Producers reserve `n` contiguous bytes, write the message in place and commit it. The single
+// consumer gets a view of the message inside the ring, valid until it commits the read. See
+// details::ByteRecords for the record format. With several producers (Mpsc) space is reserved
+// with a CAS on the tail; Spsc reserves with a plain store.
+template <std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+class ByteRing
+{
+private:
+    static_assert(CardinalityV == QueueCardinality::Mpsc || CardinalityV == QueueCardinality::Spsc, "ByteRing has a single consumer");
+
+    static constexpr bool multi_producer = CardinalityV == QueueCardinality::Mpsc;
+    static constexpr std::size_t cache_line_size_in_bytes = 64; // Assuming 64-byte cache line size
+
+    using Records = details::ByteRecords<Capacity, multi_producer>;
+    using word_t = typename Records::word_t;
+
+    // Words keep every header naturally aligned for std::atomic_ref
+    details::RingStorage<word_t, Capacity / sizeof(word_t)> buffer_;
+
+    // Byte positions, growing monotonically; `head_` is only written by the consumer
+    alignas(cache_line_size_in_bytes) std::atomic<std::size_t> head_{ 0 };
+    alignas(cache_line_size_in_bytes) std::atomic<std::size_t> tail_{ 0 };
+
+    // Consumer-private: bytes taken by the message handed out by try_read(), 0 if none
+    alignas(cache_line_size_in_bytes) std::size_t reading_{ 0 };
+
+    // Suspended producers (waiting for space) and the consumer (waiting for a message)
+    alignas(cache_line_size_in_bytes) details::WaiterList producers_;
+    alignas(cache_line_size_in_bytes) details::WaiterList consumers_;
+
+    Records records_{ &buffer_[0], &head_, &tail_ };
+    Scheduler scheduler_;
+
+    // Condition a producer waiting for a record of `length` bytes parks on
+    struct SpaceWait
+    {
+        ByteRing const * ring;
+        std::size_t length;
+
+        auto ready() const noexcept -> bool;
+    };
+
+    auto can_read() const noexcept -> bool;
+
+public:
+    explicit ByteRing(Scheduler scheduler);
+
+    // Non-copyable, non-movable
+    ByteRing(ByteRing const &) = delete;
+    auto operator=(ByteRing const &) -> ByteRing & = delete;
+    ByteRing(ByteRing &&) = delete;
+    auto operator=(ByteRing &&) -> ByteRing & = delete;
+    ~ByteRing() = default;
+
+    // Producer side. try_reserve() returns `size` writable bytes inside the ring, or std::nullopt
+    // when there is not enough free space. Throws abc_error(errc::message_too_large) when `size`
+    // exceeds max_message_size(). Every reservation must be committed, and a reservation that is
+    // not committed holds back every message reserved after it.
+    auto try_reserve(std::size_t size) -> std::optional<std::span<byte_t>>;
+    auto commit(std::span<byte_t> reserved) noexcept -> void;
+
+    // Reserve, copy `message` in and commit
+    auto try_write(std::span<byte_t const> message) -> bool;
+
+    auto async_reserve(std::size_t size) -> exec::task<std::span<byte_t>>;
+    auto async_write(std::span<byte_t const> message) -> exec::task<void>;
+
+    // Consumer side. try_read() returns a view of the oldest committed message, valid until
+    // commit_read(); calling it again before commit_read() returns the same message.
+    auto try_read() -> std::optional<bytes_view<ByteNumbering::None>>;
+    auto commit_read() noexcept -> void;
+
+    auto async_read() -> exec::task<bytes_view<ByteNumbering::None>>;
+
+    // Query operations
+    auto empty() const noexcept -> bool;
+
+    // Bytes in use, headers and padding included
+    auto size() const noexcept -> std::size_t;
+
+    constexpr auto capacity() const noexcept -> std::size_t;
+
+    // Largest payload a single message can have
+    constexpr auto max_message_size() const noexcept -> std::size_t;
+};
+
+} // namespace abc::async
+
+#endif // ABC_INCLUDE_ABC_ASYNC_BYTE_RING_DECL
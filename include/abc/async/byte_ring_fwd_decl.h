@@ -0,0 +1,23 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_BYTE_RING_FWD_DECL
+#define ABC_INCLUDE_ABC_ASYNC_BYTE_RING_FWD_DECL
+
+#pragma once
+
+#include "queue_fwd_decl.h"
+
+#include <stdexec/execution.hpp>
+
+#include <cstddef>
+
+namespace abc::async
+{
+
+template <std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV = QueueCardinality::Mpsc>
+class ByteRing;
+
+}
+
+#endif // ABC_INCLUDE_ABC_ASYNC_BYTE_RING_FWD_DECL
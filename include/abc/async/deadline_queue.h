@@ -0,0 +1,258 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_DEADLINE_QUEUE
+#define ABC_INCLUDE_ABC_ASYNC_DEADLINE_QUEUE
+
+#pragma once
+
+#include "deadline_queue_decl.h"
+#include "queue.h"
+
+#include "abc/scope_guard.h"
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace abc::async
+{
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::DropBatch::DropBatch(DeadlineQueue * queue) noexcept : queue_{ queue }
+{
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::DropBatch::~DropBatch()
+{
+    // Only left non-empty by an exception, the handler never sees these
+    release();
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+T *
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::DropBatch::items() noexcept
+{
+    return std::launder(reinterpret_cast<T *>(storage_));
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+void
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::DropBatch::release() noexcept
+{
+    if (size_ == 0)
+    {
+        return;
+    }
+
+    std::destroy_n(items(), size_);
+    queue_->queue_.mark_done(static_cast<std::int64_t>(std::exchange(size_, 0)));
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+void
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::DropBatch::add(T && item, DropReason const reason)
+{
+    if (size_ == max_size || (size_ != 0 && reason != reason_))
+    {
+        flush();
+    }
+    std::construct_at(items() + size_, std::move(item));
+    ++size_;
+    reason_ = reason;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+void
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::DropBatch::flush() noexcept
+{
+    if (size_ == 0)
+    {
+        return;
+    }
+
+    auto clear = make_scope_exit([this]() noexcept { release(); });
+    queue_->on_drop_(std::span<T>{ items(), size_ }, reason_);
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::DeadlineQueue(Scheduler scheduler, std::size_t const high_watermark, drop_handler_t on_drop)
+    : queue_{ scheduler }, high_watermark_{ high_watermark == 0 ? Capacity : std::min(high_watermark, Capacity) }, on_drop_{ std::move(on_drop) }
+{
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+void
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::drop(DropBatch & batch, Entry && entry, DropReason const reason)
+{
+    (reason == DropReason::Expired ? expired_ : shed_).fetch_add(1, std::memory_order_relaxed);
+    if (on_drop_)
+    {
+        batch.add(std::move(entry.item), reason);
+        return;
+    }
+
+    // Nobody else will see the item, so it is done as far as join() is concerned
+    queue_.mark_done(1);
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+bool
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::enqueue(T item, time_point const deadline)
+{
+    Entry entry{ std::move(item), deadline };
+
+    if constexpr (PolicyV == OverloadPolicy::RejectNewest)
+    {
+        if (queue_.size() >= high_watermark_ || !queue_.enqueue(std::move(entry)))
+        {
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+    else
+    {
+        DropBatch batch{ this };
+        time_point const now = Clock::now();
+
+        // A failed enqueue does not touch the entry, so it can be offered again
+        while (queue_.size() >= high_watermark_ || !queue_.enqueue(std::move(entry)))
+        {
+            if (auto oldest = queue_.dequeue())
+            {
+                DropReason const reason = oldest->deadline < now ? DropReason::Expired : DropReason::Shed;
+                drop(batch, std::move(*oldest), reason);
+            }
+        }
+        batch.flush();
+        return true;
+    }
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+bool
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::enqueue_within(T item, duration const budget)
+{
+    return enqueue(std::move(item), Clock::now() + budget);
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+auto
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::dequeue() -> std::optional<T>
+{
+    DropBatch batch{ this };
+    time_point const now = Clock::now();
+
+    std::optional<T> live;
+    while (auto entry = queue_.dequeue())
+    {
+        if (now <= entry->deadline)
+        {
+            live.emplace(std::move(entry->item));
+            break;
+        }
+        drop(batch, std::move(*entry), DropReason::Expired);
+    }
+    batch.flush();
+    return live;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+auto
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::async_dequeue() -> exec::task<T>
+{
+    while (true)
+    {
+        if (auto item = dequeue())
+        {
+            co_return std::move(*item);
+        }
+
+        Entry entry = co_await queue_.async_dequeue();
+        if (Clock::now() <= entry.deadline)
+        {
+            co_return std::move(entry.item);
+        }
+
+        DropBatch batch{ this };
+        drop(batch, std::move(entry), DropReason::Expired);
+        batch.flush();
+    }
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+bool
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::empty() const noexcept
+{
+    return queue_.empty();
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+std::size_t
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::size() const noexcept
+{
+    return queue_.size();
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+constexpr std::size_t
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::capacity() const noexcept
+{
+    return Capacity;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+std::size_t
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::high_watermark() const noexcept
+{
+    return high_watermark_;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+std::uint64_t
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::expired_count() const noexcept
+{
+    return expired_.load(std::memory_order_relaxed);
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+std::uint64_t
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::shed_count() const noexcept
+{
+    return shed_.load(std::memory_order_relaxed);
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+std::uint64_t
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::rejected_count() const noexcept
+{
+    return rejected_.load(std::memory_order_relaxed);
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+void
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::task_done()
+{
+    queue_.task_done();
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+auto
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::join() -> exec::task<void>
+{
+    return queue_.join();
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+void
+DeadlineQueue<T, Capacity, Scheduler, PolicyV, CardinalityV, Clock>::join_blocking()
+{
+    queue_.join_blocking();
+}
+
+} // namespace abc::async
+
+#endif // ABC_INCLUDE_ABC_ASYNC_DEADLINE_QUEUE
@@ -0,0 +1,142 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_DEADLINE_QUEUE_DECL
+#define ABC_INCLUDE_ABC_ASYNC_DEADLINE_QUEUE_DECL
+
+#pragma once
+
+#include "abc/byte.h"
+#include "deadline_queue_fwd_decl.h"
+#include "queue_decl.h"
+
+#include <exec/task.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+
+namespace abc::async
+{
+
+// Load-shedding front-end over `Queue` where every item carries a deadline, so that latency
+// stays bounded under overload instead of growing with the queue depth.
+//
+// Consumers never see an item past its deadline: dequeue skips expired items, counts them and
+// hands them to the drop handler. Producers never wait: once `high_watermark` items are queued,
+// RejectNewest refuses the new item and DropOldest drops items from the head to make room (which
+// needs a multi-consumer ring, since the producer then dequeues). Dropped items are gathered and
+// handed to the drop handler in batches of up to 16, grouped by reason; the handler must not throw.
+//
+// task_done() / join() follow Queue. Dropped items count as done, only delivered items need a
+// task_done() call.
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, OverloadPolicy PolicyV, QueueCardinality CardinalityV, typename Clock>
+class DeadlineQueue
+{
+public:
+    using clock_type = Clock;
+    using time_point = typename Clock::time_point;
+    using duration = typename Clock::duration;
+    using drop_handler_t = std::function<void(std::span<T> items, DropReason reason)>;
+
+private:
+    static_assert(PolicyV != OverloadPolicy::DropOldest || CardinalityV == QueueCardinality::Mpmc || CardinalityV == QueueCardinality::Spmc,
+                  "DropOldest makes producers dequeue, which needs a multi-consumer queue");
+
+    static constexpr std::size_t cache_line_size_in_bytes = 64; // Assuming 64-byte cache line size
+
+    struct Entry
+    {
+        T item;
+        time_point deadline;
+    };
+
+    // Dropped items gathered on the caller's stack and handed to the drop handler in batches
+    class DropBatch
+    {
+    private:
+        static constexpr std::size_t max_size = 16;
+
+        DeadlineQueue * queue_;
+        DropReason reason_{ DropReason::Expired };
+        std::size_t size_{ 0 };
+        alignas(T) byte_t storage_[max_size * sizeof(T)];
+
+        auto items() noexcept -> T *;
+
+        // Destroys the items and only then marks them done, so that join() never returns while
+        // a dropped item has yet to reach the handler
+        auto release() noexcept -> void;
+
+    public:
+        explicit DropBatch(DeadlineQueue * queue) noexcept;
+
+        DropBatch(DropBatch const &) = delete;
+        auto operator=(DropBatch const &) -> DropBatch & = delete;
+        ~DropBatch();
+
+        auto add(T && item, DropReason reason) -> void;
+        auto flush() noexcept -> void;
+    };
+
+    Queue<Entry, Capacity, Scheduler, CardinalityV> queue_;
+    std::size_t high_watermark_;
+    drop_handler_t on_drop_;
+
+    alignas(cache_line_size_in_bytes) std::atomic<std::uint64_t> expired_{ 0 };
+    std::atomic<std::uint64_t> shed_{ 0 };
+    std::atomic<std::uint64_t> rejected_{ 0 };
+
+    // Counts `entry` as dropped and passes its item to the drop handler (if any). It is marked
+    // done once the handler has seen it, right away without a handler.
+    auto drop(DropBatch & batch, Entry && entry, DropReason reason) -> void;
+
+public:
+    // `high_watermark` is capped at Capacity; 0 means Capacity
+    explicit DeadlineQueue(Scheduler scheduler, std::size_t high_watermark = Capacity, drop_handler_t on_drop = {});
+
+    // Non-copyable, non-movable
+    DeadlineQueue(DeadlineQueue const &) = delete;
+    auto operator=(DeadlineQueue const &) -> DeadlineQueue & = delete;
+    DeadlineQueue(DeadlineQueue &&) = delete;
+    auto operator=(DeadlineQueue &&) -> DeadlineQueue & = delete;
+    ~DeadlineQueue() = default;
+
+    // Enqueues `item`, to be delivered no later than `deadline`. Returns false when the item is
+    // rejected (RejectNewest at the watermark); DropOldest always succeeds.
+    auto enqueue(T item, time_point deadline) -> bool;
+
+    // Enqueues `item` with a deadline `budget` from now
+    auto enqueue_within(T item, duration budget) -> bool;
+
+    // Oldest item whose deadline has not passed; expired items in front of it are dropped.
+    // std::nullopt when no such item is queued.
+    auto dequeue() -> std::optional<T>;
+
+    // dequeue() waiting (parked) for a live item
+    auto async_dequeue() -> exec::task<T>;
+
+    // Query operations
+    auto empty() const noexcept -> bool;
+    auto size() const noexcept -> std::size_t;
+
+    constexpr auto capacity() const noexcept -> std::size_t;
+    auto high_watermark() const noexcept -> std::size_t;
+
+    // Items dropped for each reason, and items refused by enqueue(), since construction
+    auto expired_count() const noexcept -> std::uint64_t;
+    auto shed_count() const noexcept -> std::uint64_t;
+    auto rejected_count() const noexcept -> std::uint64_t;
+
+    // See Queue::task_done() / Queue::join() / Queue::join_blocking()
+    auto task_done() -> void;
+    auto join() -> exec::task<void>;
+    auto join_blocking() -> void;
+};
+
+} // namespace abc::async
+
+#endif // ABC_INCLUDE_ABC_ASYNC_DEADLINE_QUEUE_DECL
@@ -0,0 +1,43 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_DEADLINE_QUEUE_FWD_DECL
+#define ABC_INCLUDE_ABC_ASYNC_DEADLINE_QUEUE_FWD_DECL
+
+#pragma once
+
+#include "queue_fwd_decl.h"
+
+#include <stdexec/execution.hpp>
+
+#include <chrono>
+#include <cstddef>
+
+namespace abc::async
+{
+
+// What an enqueue does once the queue holds `high_watermark` items
+enum class OverloadPolicy
+{
+    RejectNewest, // the new item is refused
+    DropOldest,   // the oldest items are dropped to make room
+};
+
+// Why an item was dropped without being delivered
+enum class DropReason
+{
+    Expired, // its deadline passed while it was queued
+    Shed,    // the oldest item was dropped to make room for a new one
+};
+
+template <typename T,
+          std::size_t Capacity,
+          stdexec::scheduler Scheduler,
+          OverloadPolicy PolicyV = OverloadPolicy::RejectNewest,
+          QueueCardinality CardinalityV = QueueCardinality::Mpmc,
+          typename Clock = std::chrono::steady_clock>
+class DeadlineQueue;
+
+}
+
+#endif // ABC_INCLUDE_ABC_ASYNC_DEADLINE_QUEUE_FWD_DECL
@@ -0,0 +1,223 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_DETAILS_BYTE_RECORDS
+#define ABC_INCLUDE_ABC_ASYNC_DETAILS_BYTE_RECORDS
+
+#pragma once
+
+#include "abc/byte.h"
+#include "abc/bytes_view.h"
+#include "abc/error.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+
+namespace abc::async::details
+{
+
+// Record format and protocol of a ring of variable-length messages, over storage owned by the
+// caller (in process for ByteRing, in shared memory for SharedByteRing).
+//
+// Every message is a record: an 8-byte header followed by the payload, padded to a multiple of
+// 8. A message that does not fit before the end of the ring is preceded by a padding record
+// filling the rest, so payloads are never split. Head and tail are byte positions growing
+// monotonically; only the single consumer moves the head.
+//
+// The header word is 0 until the record is committed. The consumer zeroes every record it is
+// done with, so whatever a producer reserves next reads as "not committed yet". With several
+// producers space is reserved with a CAS on the tail; records are committed in any order but
+// read in reservation order.
+template <std::size_t Capacity, bool MultiProducer>
+class ByteRecords
+{
+public:
+    using word_t = std::uint64_t;
+
+    static constexpr std::size_t header_size = sizeof(word_t);
+
+    // A record of at most half the ring always fits once the ring is empty, padding included
+    static constexpr std::size_t max_message_size = Capacity / 2 - header_size;
+
+    static_assert(Capacity >= 2 * (header_size + sizeof(word_t)), "Byte ring capacity must hold at least two records");
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
+
+private:
+    // Header layout: payload size (or record length for padding) << 2 | padding << 1 | committed
+    static constexpr word_t committed_bit = 1;
+    static constexpr word_t padding_bit = 2;
+
+    word_t * words_;
+    std::atomic<std::size_t> * head_;
+    std::atomic<std::size_t> * tail_;
+
+    auto
+    bytes() const noexcept -> byte_t *
+    {
+        return reinterpret_cast<byte_t *>(words_);
+    }
+
+    auto
+    header_at(std::size_t const offset) const noexcept -> std::atomic_ref<word_t>
+    {
+        return std::atomic_ref<word_t>{ words_[offset / sizeof(word_t)] };
+    }
+
+    // Bytes a record of `length` takes when reserved at `tail`, including the padding in front
+    static constexpr auto
+    footprint(std::size_t const tail, std::size_t const length) noexcept -> std::size_t
+    {
+        std::size_t const offset = tail & (Capacity - 1);
+        return offset + length > Capacity ? Capacity - offset + length : length;
+    }
+
+    // Offset of the first real header at or after the head, looking through a padding record
+    auto
+    message_offset(std::size_t const offset, word_t & header) const noexcept -> std::size_t
+    {
+        header = header_at(offset).load(std::memory_order_acquire);
+        if ((header & padding_bit) == 0)
+        {
+            return offset;
+        }
+        header = header_at(0).load(std::memory_order_acquire);
+        return 0;
+    }
+
+public:
+    ByteRecords(word_t * words, std::atomic<std::size_t> * head, std::atomic<std::size_t> * tail) noexcept : words_{ words }, head_{ head }, tail_{ tail }
+    {
+    }
+
+    static constexpr auto
+    record_length(std::size_t const size) noexcept -> std::size_t
+    {
+        return (header_size + size + sizeof(word_t) - 1) & ~(sizeof(word_t) - 1);
+    }
+
+    // True when a record of `length` bytes could be reserved right now
+    auto
+    fits(std::size_t const length) const noexcept -> bool
+    {
+        std::size_t const tail = tail_->load(std::memory_order_relaxed);
+        return tail + footprint(tail, length) - head_->load(std::memory_order_acquire) <= Capacity;
+    }
+
+    // Returns `size` writable bytes, or std::nullopt when there is not enough free space. Throws
+    // abc_error(errc::message_too_large) when `size` exceeds max_message_size.
+    auto
+    try_reserve(std::size_t const size) -> std::optional<std::span<byte_t>>
+    {
+        if (size > max_message_size)
+        {
+            throw_error(make_error_code(errc::message_too_large));
+        }
+
+        std::size_t const length = record_length(size);
+        std::size_t tail = tail_->load(std::memory_order_relaxed);
+        std::size_t reserved;
+        while (true)
+        {
+            // The acquire pairs with the consumer releasing the space it zeroed
+            reserved = footprint(tail, length);
+            if (tail + reserved - head_->load(std::memory_order_acquire) > Capacity)
+            {
+                return std::nullopt;
+            }
+
+            if constexpr (MultiProducer)
+            {
+                if (tail_->compare_exchange_weak(tail, tail + reserved, std::memory_order_relaxed, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else
+            {
+                tail_->store(tail + reserved, std::memory_order_relaxed);
+                break;
+            }
+        }
+
+        std::size_t offset = tail & (Capacity - 1);
+        if (reserved != length)
+        {
+            // Skip the rest of the ring, the record starts over at offset 0
+            header_at(offset).store(((Capacity - offset) << 2) | padding_bit | committed_bit, std::memory_order_release);
+            offset = 0;
+        }
+        return std::span<byte_t>{ bytes() + offset + header_size, size };
+    }
+
+    auto
+    commit(std::span<byte_t> const reserved) const noexcept -> void
+    {
+        std::size_t const offset = static_cast<std::size_t>(reserved.data() - bytes()) - header_size;
+        header_at(offset).store((static_cast<word_t>(reserved.size()) << 2) | committed_bit, std::memory_order_release);
+    }
+
+    // True when try_read() would return a message
+    auto
+    readable(std::size_t const reading) const noexcept -> bool
+    {
+        word_t header;
+        message_offset(head_->load(std::memory_order_relaxed) & (Capacity - 1), header);
+        return reading != 0 || header != 0;
+    }
+
+    // View of the oldest committed message. `reading` is the consumer's bookkeeping: the bytes
+    // the outstanding message (and the padding in front of it) takes, 0 when there is none.
+    auto
+    try_read(std::size_t & reading) const noexcept -> std::optional<bytes_view<ByteNumbering::None>>
+    {
+        std::size_t const head_offset = head_->load(std::memory_order_relaxed) & (Capacity - 1);
+        word_t header;
+        std::size_t const offset = message_offset(head_offset, header);
+        if (header == 0)
+        {
+            return std::nullopt;
+        }
+
+        std::size_t const size = static_cast<std::size_t>(header >> 2);
+        reading = (offset == head_offset ? 0 : Capacity - head_offset) + record_length(size);
+        return bytes_view<ByteNumbering::None>::from(std::span<byte_t const>{ bytes() + offset + header_size, size });
+    }
+
+    // Releases the message returned by try_read(). The whole record is zeroed, since any of its
+    // words may be a header in the next lap.
+    auto
+    commit_read(std::size_t & reading) const noexcept -> void
+    {
+        std::size_t const head = head_->load(std::memory_order_relaxed);
+        std::size_t const offset = head & (Capacity - 1);
+        if (offset + reading > Capacity)
+        {
+            std::memset(bytes() + offset, 0, Capacity - offset);
+            std::memset(bytes(), 0, reading - (Capacity - offset));
+        }
+        else
+        {
+            std::memset(bytes() + offset, 0, reading);
+        }
+
+        head_->store(head + reading, std::memory_order_release);
+        reading = 0;
+    }
+
+    // Bytes in use, headers and padding included
+    auto
+    size() const noexcept -> std::size_t
+    {
+        // The head never passes the tail, so loading it first keeps the difference non-negative
+        std::size_t const head = head_->load(std::memory_order_acquire);
+        return tail_->load(std::memory_order_acquire) - head;
+    }
+};
+
+} // namespace abc::async::details
+
+#endif // ABC_INCLUDE_ABC_ASYNC_DETAILS_BYTE_RECORDS
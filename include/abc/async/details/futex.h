@@ -0,0 +1,132 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_DETAILS_FUTEX
+#define ABC_INCLUDE_ABC_ASYNC_DETAILS_FUTEX
+
+#pragma once
+
+#include "abc/details/config.h"
+
+#if defined(ABC_OS_LINUX)
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <ctime>
+#include <optional>
+#include <thread>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace abc::async::details
+{
+
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t) && std::atomic<std::uint32_t>::is_always_lock_free, "futex words must be plain 32-bit atomics");
+
+// Sleeps while `word` holds `expected`, for at most `timeout` when given. The shared (not
+// process-private) futex operations are used, so `word` may live in memory mapped by several
+// processes. Returns on wake-up, timeout, signal or spuriously alike: callers re-check.
+inline auto
+futex_wait(std::atomic<std::uint32_t> & word, std::uint32_t const expected, std::optional<std::chrono::nanoseconds> const timeout = std::nullopt) noexcept -> void
+{
+    timespec relative{};
+    if (timeout)
+    {
+        auto const nanoseconds = timeout->count() > 0 ? timeout->count() : 0;
+        relative.tv_sec = static_cast<std::time_t>(nanoseconds / 1'000'000'000);
+        relative.tv_nsec = static_cast<long>(nanoseconds % 1'000'000'000);
+    }
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAIT, expected, timeout ? &relative : nullptr, nullptr, 0);
+}
+
+// Wakes up to `count` threads (of any process) sleeping on `word`
+inline auto
+futex_wake(std::atomic<std::uint32_t> & word, int const count) noexcept -> void
+{
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAKE, count, nullptr, nullptr, 0);
+}
+
+// Event processes block on until a condition may have become true, for rings in shared memory.
+// A waiter announces itself in `waiters` and re-checks its condition before sleeping on `epoch`;
+// a notifier publishes, bumps `epoch` and only makes the system call when someone announced
+// itself. The fences on both sides (the same handshake as WaiterList) make sure either the
+// waiter sees the published state or the notifier sees the waiter. All-zero is the initial state.
+struct FutexEvent
+{
+    static constexpr int spin_yields = 16;
+
+    std::atomic<std::uint32_t> epoch;
+    std::atomic<std::uint32_t> waiters;
+
+    // Blocks until `ready()` holds, or until `deadline` when given. Returns the final `ready()`.
+    template <typename Ready>
+    auto
+    wait(Ready && ready, std::optional<std::chrono::steady_clock::time_point> const deadline = std::nullopt) noexcept -> bool
+    {
+        // Peers usually catch up within a few time slices, which is much cheaper than a
+        // sleep / wake-up pair of system calls on both sides
+        for (int i = 0; i < spin_yields; ++i)
+        {
+            if (ready())
+            {
+                return true;
+            }
+            std::this_thread::yield();
+        }
+
+        while (!ready())
+        {
+            // Read the epoch before re-checking, so a notification in between changes it
+            std::uint32_t const seen = epoch.load(std::memory_order_acquire);
+            waiters.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            bool const now_ready = ready();
+            std::optional<std::chrono::nanoseconds> timeout;
+            if (!now_ready && deadline)
+            {
+                timeout = *deadline - std::chrono::steady_clock::now();
+            }
+            if (!now_ready && (!timeout || timeout->count() > 0))
+            {
+                futex_wait(epoch, seen, timeout);
+            }
+            waiters.fetch_sub(1, std::memory_order_relaxed);
+
+            if (!now_ready && timeout && timeout->count() <= 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Call after publishing the state waiters check; wakes up to `count` of them
+    auto
+    notify(int const count) noexcept -> void
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters.load(std::memory_order_relaxed) == 0)
+        {
+            return;
+        }
+        epoch.fetch_add(1, std::memory_order_release);
+        futex_wake(epoch, count);
+    }
+
+    auto
+    notify_all() noexcept -> void
+    {
+        notify(INT_MAX);
+    }
+};
+
+} // namespace abc::async::details
+
+#endif // ABC_OS_LINUX
+
+#endif // ABC_INCLUDE_ABC_ASYNC_DETAILS_FUTEX
@@ -0,0 +1,130 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_DETAILS_PARK_AWAITER
+#define ABC_INCLUDE_ABC_ASYNC_DETAILS_PARK_AWAITER
+
+#pragma once
+
+#include "waiter_list.h"
+
+#include <stdexec/execution.hpp>
+
+#include <cassert>
+#include <coroutine>
+#include <optional>
+
+namespace abc::async::details
+{
+
+// Awaiter parking the calling coroutine on a waiter list until `(owner->*ready)()` may have
+// become true. It is resumed through `scheduler` by whoever notifies the list.
+template <typename Owner, stdexec::scheduler Scheduler>
+class ParkAwaiter : public Waiter
+{
+private:
+    struct Receiver
+    {
+        using receiver_concept = stdexec::receiver_t;
+
+        ParkAwaiter * awaiter_;
+
+        auto
+        set_value() noexcept -> void
+        {
+            awaiter_->continuation_.resume();
+        }
+
+        template <typename Error>
+        auto
+        set_error(Error &&) noexcept -> void
+        {
+            // The scheduler failed to hop, resume in place and let the caller retry its operation
+            awaiter_->continuation_.resume();
+        }
+
+        auto
+        set_stopped() noexcept -> void
+        {
+            awaiter_->continuation_.resume();
+        }
+
+        auto
+        get_env() const noexcept -> stdexec::env<>
+        {
+            return {};
+        }
+    };
+
+    using operation_type = stdexec::connect_result_t<stdexec::schedule_result_t<Scheduler &>, Receiver>;
+
+    Scheduler * scheduler_;
+    WaiterList * list_;
+    Owner const * owner_;
+    bool (Owner::*ready_)() const noexcept;
+    std::coroutine_handle<> continuation_{};
+    std::optional<operation_type> operation_{};
+
+    static auto
+    resume_on_scheduler(Waiter * waiter) noexcept -> void
+    {
+        auto * self = static_cast<ParkAwaiter *>(waiter);
+
+        // Operation states are immovable, so build it in place from the connect() result
+        struct Connect
+        {
+            ParkAwaiter * self;
+
+            operator operation_type() const
+            {
+                return stdexec::connect(stdexec::schedule(*self->scheduler_), Receiver{ self });
+            }
+        };
+
+        stdexec::start(self->operation_.emplace(Connect{ self }));
+    }
+
+public:
+    ParkAwaiter(Scheduler & scheduler, WaiterList & list, Owner const * owner, bool (Owner::*ready)() const noexcept) noexcept
+        : scheduler_{ &scheduler }, list_{ &list }, owner_{ owner }, ready_{ ready }
+    {
+        this->resume_fn = &ParkAwaiter::resume_on_scheduler;
+    }
+
+    // Awaiters may be moved into the coroutine frame before they are awaited, never after
+    ParkAwaiter(ParkAwaiter && other) noexcept : ParkAwaiter{ *other.scheduler_, *other.list_, other.owner_, other.ready_ }
+    {
+        assert(!other.operation_.has_value());
+    }
+
+    ParkAwaiter(ParkAwaiter const &) = delete;
+    auto operator=(ParkAwaiter const &) -> ParkAwaiter & = delete;
+    auto operator=(ParkAwaiter &&) -> ParkAwaiter & = delete;
+
+    auto
+    await_ready() const noexcept -> bool
+    {
+        return false;
+    }
+
+    auto
+    await_suspend(std::coroutine_handle<> continuation) -> bool
+    {
+        continuation_ = continuation;
+
+        // Once parked, this awaiter may be resumed (and destroyed) by another thread at any time,
+        // so nothing but locals may be touched after park() returns true.
+        Owner const * owner = owner_;
+        auto ready = ready_;
+        return list_->park(this, [owner, ready] { return (owner->*ready)(); });
+    }
+
+    auto
+    await_resume() const noexcept -> void
+    {
+    }
+};
+
+} // namespace abc::async::details
+
+#endif // ABC_INCLUDE_ABC_ASYNC_DETAILS_PARK_AWAITER
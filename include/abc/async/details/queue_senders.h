@@ -0,0 +1,265 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_DETAILS_QUEUE_SENDERS
+#define ABC_INCLUDE_ABC_ASYNC_DETAILS_QUEUE_SENDERS
+
+#pragma once
+
+#include "waiter_list.h"
+
+#include <stdexec/execution.hpp>
+
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace abc::async::details
+{
+
+// Where a queue operation waits when it cannot complete: the waiter list, the condition that
+// makes a retry worthwhile and the scheduler the retry runs on.
+template <typename Queue, stdexec::scheduler Scheduler>
+struct ParkSite
+{
+    Queue * queue;
+    Scheduler * scheduler;
+    WaiterList * list;
+    bool (Queue::*ready)() const noexcept;
+};
+
+// Operation state base running `Derived::try_complete()` until it reports completion. Between
+// attempts the operation is parked on the site's waiter list and resumed through the site's
+// scheduler. The first attempt runs inside start(), so an operation that can complete right
+// away does so synchronously, without touching the scheduler.
+template <typename Derived, typename Queue, stdexec::scheduler Scheduler>
+class ParkingOperation : public Waiter
+{
+private:
+    struct HopReceiver
+    {
+        using receiver_concept = stdexec::receiver_t;
+
+        ParkingOperation * operation_;
+
+        auto
+        set_value() noexcept -> void
+        {
+            operation_->run();
+        }
+
+        template <typename Error>
+        auto
+        set_error(Error &&) noexcept -> void
+        {
+            // The scheduler failed to hop, retry in place
+            operation_->run();
+        }
+
+        auto
+        set_stopped() noexcept -> void
+        {
+            operation_->run();
+        }
+
+        auto
+        get_env() const noexcept -> stdexec::env<>
+        {
+            return {};
+        }
+    };
+
+    using hop_type = stdexec::connect_result_t<stdexec::schedule_result_t<Scheduler &>, HopReceiver>;
+
+    ParkSite<Queue, Scheduler> site_;
+    std::optional<hop_type> hop_{};
+
+    static auto
+    resume_on_scheduler(Waiter * waiter) noexcept -> void
+    {
+        auto * self = static_cast<ParkingOperation *>(waiter);
+
+        // Operation states are immovable, so build it in place from the connect() result
+        struct Connect
+        {
+            ParkingOperation * self;
+
+            operator hop_type() const
+            {
+                return stdexec::connect(stdexec::schedule(*self->site_.scheduler), HopReceiver{ self });
+            }
+        };
+
+        stdexec::start(self->hop_.emplace(Connect{ self }));
+    }
+
+protected:
+    explicit ParkingOperation(ParkSite<Queue, Scheduler> site) noexcept : site_{ site }
+    {
+        this->resume_fn = &ParkingOperation::resume_on_scheduler;
+    }
+
+    auto
+    queue() const noexcept -> Queue *
+    {
+        return site_.queue;
+    }
+
+    // Once the receiver is completed or the operation is parked, it may be destroyed by another
+    // thread at any time, so nothing but locals may be touched afterwards.
+    auto
+    run() noexcept -> void
+    {
+        while (!static_cast<Derived *>(this)->try_complete())
+        {
+            Queue * queue = site_.queue;
+            auto ready = site_.ready;
+            if (site_.list->park(this, [queue, ready] { return (queue->*ready)(); }))
+            {
+                return;
+            }
+        }
+    }
+
+public:
+    ParkingOperation(ParkingOperation const &) = delete;
+    auto operator=(ParkingOperation const &) -> ParkingOperation & = delete;
+    ParkingOperation(ParkingOperation &&) = delete;
+    auto operator=(ParkingOperation &&) -> ParkingOperation & = delete;
+
+    auto
+    start() noexcept -> void
+    {
+        run();
+    }
+};
+
+template <typename Queue, stdexec::scheduler Scheduler, typename T, typename Receiver>
+class EnqueueOperation : public ParkingOperation<EnqueueOperation<Queue, Scheduler, T, Receiver>, Queue, Scheduler>
+{
+private:
+    using base_type = ParkingOperation<EnqueueOperation, Queue, Scheduler>;
+    friend base_type;
+
+    T item_;
+    Receiver receiver_;
+
+    auto
+    try_complete() noexcept -> bool
+    {
+        try
+        {
+            if (!this->queue()->enqueue(std::move(item_)))
+            {
+                return false;
+            }
+        }
+        catch (...)
+        {
+            stdexec::set_error(std::move(receiver_), std::current_exception());
+            return true;
+        }
+
+        stdexec::set_value(std::move(receiver_));
+        return true;
+    }
+
+public:
+    using operation_state_concept = stdexec::operation_state_t;
+
+    EnqueueOperation(ParkSite<Queue, Scheduler> site, T && item, Receiver && receiver)
+        : base_type{ site }, item_{ std::move(item) }, receiver_{ std::move(receiver) }
+    {
+    }
+};
+
+template <typename Queue, stdexec::scheduler Scheduler, typename T, typename Receiver>
+class DequeueOperation : public ParkingOperation<DequeueOperation<Queue, Scheduler, T, Receiver>, Queue, Scheduler>
+{
+private:
+    using base_type = ParkingOperation<DequeueOperation, Queue, Scheduler>;
+    friend base_type;
+
+    Receiver receiver_;
+
+    auto
+    try_complete() noexcept -> bool
+    {
+        std::optional<T> item;
+        try
+        {
+            item = this->queue()->dequeue();
+        }
+        catch (...)
+        {
+            stdexec::set_error(std::move(receiver_), std::current_exception());
+            return true;
+        }
+
+        if (!item)
+        {
+            return false;
+        }
+
+        stdexec::set_value(std::move(receiver_), std::move(*item));
+        return true;
+    }
+
+public:
+    using operation_state_concept = stdexec::operation_state_t;
+
+    DequeueOperation(ParkSite<Queue, Scheduler> site, Receiver && receiver) : base_type{ site }, receiver_{ std::move(receiver) }
+    {
+    }
+};
+
+// Sender enqueueing `item`, waiting (parked, without a coroutine frame) while the queue is full
+template <typename Queue, stdexec::scheduler Scheduler, typename T>
+class EnqueueSender
+{
+private:
+    ParkSite<Queue, Scheduler> site_;
+    T item_;
+
+public:
+    using sender_concept = stdexec::sender_t;
+    using completion_signatures = stdexec::completion_signatures<stdexec::set_value_t(), stdexec::set_error_t(std::exception_ptr)>;
+
+    EnqueueSender(ParkSite<Queue, Scheduler> site, T && item) : site_{ site }, item_{ std::move(item) }
+    {
+    }
+
+    template <stdexec::receiver Receiver>
+    auto
+    connect(Receiver receiver) && -> EnqueueOperation<Queue, Scheduler, T, Receiver>
+    {
+        return EnqueueOperation<Queue, Scheduler, T, Receiver>{ site_, std::move(item_), std::move(receiver) };
+    }
+};
+
+// Sender dequeueing one item, waiting (parked, without a coroutine frame) while the queue is empty
+template <typename Queue, stdexec::scheduler Scheduler, typename T>
+class DequeueSender
+{
+private:
+    ParkSite<Queue, Scheduler> site_;
+
+public:
+    using sender_concept = stdexec::sender_t;
+    using completion_signatures = stdexec::completion_signatures<stdexec::set_value_t(T), stdexec::set_error_t(std::exception_ptr)>;
+
+    explicit DequeueSender(ParkSite<Queue, Scheduler> site) noexcept : site_{ site }
+    {
+    }
+
+    template <stdexec::receiver Receiver>
+    auto
+    connect(Receiver receiver) && -> DequeueOperation<Queue, Scheduler, T, Receiver>
+    {
+        return DequeueOperation<Queue, Scheduler, T, Receiver>{ site_, std::move(receiver) };
+    }
+};
+
+} // namespace abc::async::details
+
+#endif // ABC_INCLUDE_ABC_ASYNC_DETAILS_QUEUE_SENDERS
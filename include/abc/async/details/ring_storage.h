@@ -0,0 +1,116 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_DETAILS_RING_STORAGE
+#define ABC_INCLUDE_ABC_ASYNC_DETAILS_RING_STORAGE
+
+#pragma once
+
+#include "abc/memory.h"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+namespace abc::async::details
+{
+
+// Cells of a ring whose capacity is known at compile time, stored inline and value-initialized.
+template <typename Cell, std::size_t Capacity>
+class RingStorage
+{
+private:
+    std::array<Cell, Capacity> cells_{};
+
+public:
+    RingStorage() = default;
+
+    constexpr auto
+    operator[](std::size_t const index) noexcept -> Cell &
+    {
+        return cells_[index];
+    }
+
+    constexpr auto
+    operator[](std::size_t const index) const noexcept -> Cell const &
+    {
+        return cells_[index];
+    }
+
+    static constexpr auto
+    size() noexcept -> std::size_t
+    {
+        return Capacity;
+    }
+};
+
+// Cells of a ring whose capacity is chosen at construction. They live in zero-filled pages from
+// `allocate_pages`, so a trivially default constructible cell is already in its value-initialized
+// state and nothing is written up front: start-up cost scales with the pages actually touched.
+// Other cells are value-initialized eagerly.
+template <typename Cell>
+class RingStorage<Cell, std::dynamic_extent>
+{
+private:
+    std::size_t size_;
+    Cell * cells_;
+
+    static constexpr bool zero_filled_is_initialized = std::is_trivially_default_constructible_v<Cell>;
+
+public:
+    explicit RingStorage(std::size_t const size) : size_{ size }, cells_{ static_cast<Cell *>(allocate_pages(size * sizeof(Cell))) }
+    {
+        static_assert(alignof(Cell) <= 4096, "Cell alignment exceeds the page size");
+
+        if constexpr (!zero_filled_is_initialized)
+        {
+            try
+            {
+                std::uninitialized_value_construct_n(cells_, size_);
+            }
+            catch (...)
+            {
+                deallocate_pages(cells_, size_ * sizeof(Cell));
+                throw;
+            }
+        }
+    }
+
+    RingStorage(RingStorage const &) = delete;
+    auto operator=(RingStorage const &) -> RingStorage & = delete;
+    RingStorage(RingStorage &&) = delete;
+    auto operator=(RingStorage &&) -> RingStorage & = delete;
+
+    ~RingStorage()
+    {
+        if constexpr (!std::is_trivially_destructible_v<Cell>)
+        {
+            std::destroy_n(cells_, size_);
+        }
+        deallocate_pages(cells_, size_ * sizeof(Cell));
+    }
+
+    auto
+    operator[](std::size_t const index) noexcept -> Cell &
+    {
+        return cells_[index];
+    }
+
+    auto
+    operator[](std::size_t const index) const noexcept -> Cell const &
+    {
+        return cells_[index];
+    }
+
+    auto
+    size() const noexcept -> std::size_t
+    {
+        return size_;
+    }
+};
+
+} // namespace abc::async::details
+
+#endif // ABC_INCLUDE_ABC_ASYNC_DETAILS_RING_STORAGE
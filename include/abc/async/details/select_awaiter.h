@@ -0,0 +1,244 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_DETAILS_SELECT_AWAITER
+#define ABC_INCLUDE_ABC_ASYNC_DETAILS_SELECT_AWAITER
+
+#pragma once
+
+#include "waiter_list.h"
+
+#include <stdexec/execution.hpp>
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <coroutine>
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+namespace abc::async::details
+{
+
+// Awaiter parking the calling coroutine on the waiter lists of several park sites at once. It is
+// resumed through `scheduler` once any of them is notified (or found ready while parking), and
+// await_resume() returns the index of that site, sizeof...(Sites) when a site was already ready.
+//
+// The first notified node wins and withdraws the others. A node notified after that hands the
+// wakeup on to the next waiter of its list, so that no other consumer misses it. The coroutine is
+// resumed only once every node is settled (withdrawn or done being notified), so no notifier can
+// touch the awaiter after it is destroyed.
+template <stdexec::scheduler Scheduler, typename... Sites>
+class SelectAwaiter
+{
+private:
+    static constexpr std::size_t site_count = sizeof...(Sites);
+    static constexpr std::size_t none = site_count;
+
+    struct Node : Waiter
+    {
+        SelectAwaiter * awaiter{ nullptr };
+        WaiterList * list{ nullptr };
+    };
+
+    struct Receiver
+    {
+        using receiver_concept = stdexec::receiver_t;
+
+        SelectAwaiter * awaiter_;
+
+        auto
+        set_value() noexcept -> void
+        {
+            awaiter_->continuation_.resume();
+        }
+
+        template <typename Error>
+        auto
+        set_error(Error &&) noexcept -> void
+        {
+            // The scheduler failed to hop, resume in place and let the caller retry its selection
+            awaiter_->continuation_.resume();
+        }
+
+        auto
+        set_stopped() noexcept -> void
+        {
+            awaiter_->continuation_.resume();
+        }
+
+        auto
+        get_env() const noexcept -> stdexec::env<>
+        {
+            return {};
+        }
+    };
+
+    using operation_type = stdexec::connect_result_t<stdexec::schedule_result_t<Scheduler &>, Receiver>;
+
+    Scheduler * scheduler_;
+    std::tuple<Sites...> sites_;
+    std::array<Node, site_count> nodes_{};
+
+    std::atomic<bool> fired_{ false };
+    std::size_t winner_{ none };
+
+    // Parked nodes not yet settled, plus one while await_suspend() is still parking
+    std::atomic<std::size_t> outstanding_{ 0 };
+
+    std::coroutine_handle<> continuation_{};
+    std::optional<operation_type> operation_{};
+
+    // Claims the wakeup for `winner` and withdraws every other node still parked
+    auto
+    fire(std::size_t const winner) noexcept -> bool
+    {
+        if (fired_.exchange(true, std::memory_order_acq_rel))
+        {
+            return false;
+        }
+
+        winner_ = winner;
+        for (std::size_t i = 0; i != site_count; ++i)
+        {
+            if (i != winner && nodes_[i].list->withdraw(&nodes_[i]))
+            {
+                outstanding_.fetch_sub(1, std::memory_order_acq_rel);
+            }
+        }
+        return true;
+    }
+
+    auto
+    settle() noexcept -> void
+    {
+        if (outstanding_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            resume_on_scheduler();
+        }
+    }
+
+    auto
+    resume_on_scheduler() noexcept -> void
+    {
+        // Operation states are immovable, so build it in place from the connect() result
+        struct Connect
+        {
+            SelectAwaiter * self;
+
+            operator operation_type() const
+            {
+                return stdexec::connect(stdexec::schedule(*self->scheduler_), Receiver{ self });
+            }
+        };
+
+        stdexec::start(operation_.emplace(Connect{ this }));
+    }
+
+    static auto
+    on_notified(Waiter * waiter) noexcept -> void
+    {
+        auto * node = static_cast<Node *>(waiter);
+        SelectAwaiter * self = node->awaiter;
+
+        if (!self->fire(static_cast<std::size_t>(node - self->nodes_.data())))
+        {
+            // Another site won, pass the wakeup on to whoever else waits here
+            node->list->notify_one();
+        }
+        self->settle();
+    }
+
+    // Parks node `I`. Returns false when parking has to stop: site `I` is ready, or another
+    // site has already fired.
+    template <std::size_t I>
+    auto
+    park_one() -> bool
+    {
+        auto & site = std::get<I>(sites_);
+        auto * queue = site.queue;
+        auto ready = site.ready;
+
+        outstanding_.fetch_add(1, std::memory_order_relaxed);
+        if (!site.list->park(&nodes_[I], [queue, ready] { return (queue->*ready)(); }))
+        {
+            outstanding_.fetch_sub(1, std::memory_order_relaxed);
+            fire(none);
+            return false;
+        }
+
+        // A site that fired before this node was parked could not withdraw it
+        if (fired_.load(std::memory_order_seq_cst))
+        {
+            if (site.list->withdraw(&nodes_[I]))
+            {
+                outstanding_.fetch_sub(1, std::memory_order_relaxed);
+            }
+            return false;
+        }
+        return true;
+    }
+
+    template <std::size_t... Is>
+    auto
+    park_all(std::index_sequence<Is...>) -> void
+    {
+        (park_one<Is>() && ...);
+    }
+
+    SelectAwaiter(Scheduler * scheduler, std::tuple<Sites...> const & sites) noexcept : scheduler_{ scheduler }, sites_{ sites }
+    {
+        std::size_t i = 0;
+        std::apply(
+            [this, &i](auto const &... site) {
+                ((nodes_[i].awaiter = this, nodes_[i].list = site.list, nodes_[i].resume_fn = &SelectAwaiter::on_notified, ++i), ...);
+            },
+            sites_);
+    }
+
+public:
+    explicit SelectAwaiter(Scheduler & scheduler, Sites... sites) noexcept : SelectAwaiter{ &scheduler, std::tuple<Sites...>{ sites... } }
+    {
+    }
+
+    // Awaiters may be moved into the coroutine frame before they are awaited, never after
+    SelectAwaiter(SelectAwaiter && other) noexcept : SelectAwaiter{ other.scheduler_, other.sites_ }
+    {
+        assert(!other.operation_.has_value());
+    }
+
+    SelectAwaiter(SelectAwaiter const &) = delete;
+    auto operator=(SelectAwaiter const &) -> SelectAwaiter & = delete;
+    auto operator=(SelectAwaiter &&) -> SelectAwaiter & = delete;
+
+    auto
+    await_ready() const noexcept -> bool
+    {
+        return false;
+    }
+
+    auto
+    await_suspend(std::coroutine_handle<> continuation) -> bool
+    {
+        continuation_ = continuation;
+        outstanding_.store(1, std::memory_order_relaxed);
+
+        // Parked nodes cannot resume the coroutine while the parking guard is held, so members
+        // stay valid until it is released. Whoever settles last resumes the coroutine; when that
+        // is this call, it simply does not suspend.
+        park_all(std::index_sequence_for<Sites...>{});
+        return outstanding_.fetch_sub(1, std::memory_order_acq_rel) != 1;
+    }
+
+    auto
+    await_resume() const noexcept -> std::size_t
+    {
+        return winner_;
+    }
+};
+
+} // namespace abc::async::details
+
+#endif // ABC_INCLUDE_ABC_ASYNC_DETAILS_SELECT_AWAITER
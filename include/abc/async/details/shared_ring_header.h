@@ -0,0 +1,165 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_DETAILS_SHARED_RING_HEADER
+#define ABC_INCLUDE_ABC_ASYNC_DETAILS_SHARED_RING_HEADER
+
+#pragma once
+
+#include "abc/error.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace abc::async::details
+{
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "shared memory rings need lock-free 64-bit atomics");
+
+enum class SharedRingKind : std::uint32_t
+{
+    Queue = 1,
+    ByteRing = 2,
+};
+
+// What a shared-memory ring was built for. A process attaching with different template
+// arguments (or a different build of the format) is refused instead of misreading the segment.
+struct SharedRingGeometry
+{
+    std::uint32_t kind;
+    std::uint32_t cardinality;
+    std::uint64_t capacity;
+    std::uint64_t element_size;
+    std::uint64_t element_alignment;
+    std::uint64_t layout_size;
+
+    friend auto operator==(SharedRingGeometry const &, SharedRingGeometry const &) -> bool = default;
+};
+
+// SharedRingGeometry as stored in a header, every field atomic, so that a process validating the
+// segment while another one re-initializes it reads torn values rather than racing on them
+struct SharedRingGeometryCell
+{
+    std::atomic<std::uint32_t> kind;
+    std::atomic<std::uint32_t> cardinality;
+    std::atomic<std::uint64_t> capacity;
+    std::atomic<std::uint64_t> element_size;
+    std::atomic<std::uint64_t> element_alignment;
+    std::atomic<std::uint64_t> layout_size;
+
+    auto
+    load() const noexcept -> SharedRingGeometry
+    {
+        return SharedRingGeometry{
+            kind.load(std::memory_order_relaxed),
+            cardinality.load(std::memory_order_relaxed),
+            capacity.load(std::memory_order_relaxed),
+            element_size.load(std::memory_order_relaxed),
+            element_alignment.load(std::memory_order_relaxed),
+            layout_size.load(std::memory_order_relaxed),
+        };
+    }
+
+    auto
+    store(SharedRingGeometry const & geometry) noexcept -> void
+    {
+        kind.store(geometry.kind, std::memory_order_relaxed);
+        cardinality.store(geometry.cardinality, std::memory_order_relaxed);
+        capacity.store(geometry.capacity, std::memory_order_relaxed);
+        element_size.store(geometry.element_size, std::memory_order_relaxed);
+        element_alignment.store(geometry.element_alignment, std::memory_order_relaxed);
+        layout_size.store(geometry.layout_size, std::memory_order_relaxed);
+    }
+};
+
+static_assert(sizeof(SharedRingGeometryCell) == sizeof(SharedRingGeometry), "the stored geometry keeps the segment layout");
+
+// First bytes of a shared-memory ring. `state` tells whether the segment is usable: a creator
+// marks it initializing before touching anything and ready only once the whole ring is set up,
+// so a creator dying half-way leaves a segment nobody attaches to. Every (re-)creation bumps
+// `generation`, which lets peers still mapping the old ring find out it was replaced.
+struct SharedRingHeader
+{
+    static constexpr std::uint64_t magic_value = 0x474e495248534241; // "ABSHRING"
+    static constexpr std::uint32_t format_version = 1;
+
+    enum : std::uint32_t
+    {
+        uninitialized = 0,
+        initializing = 1,
+        ready = 2,
+    };
+
+    std::atomic<std::uint64_t> magic;
+    std::atomic<std::uint32_t> state;
+    std::atomic<std::uint32_t> version;
+    std::atomic<std::uint64_t> generation;
+    SharedRingGeometryCell geometry;
+
+    // Marks the segment unusable while the caller (re-)initializes the ring behind the header
+    auto
+    begin_initialize(SharedRingGeometry const & expected) noexcept -> void
+    {
+        state.store(initializing, std::memory_order_seq_cst);
+
+        // Pairs with the fence in validate(): a validator reading any field written below sees
+        // the segment not ready when it checks again
+        std::atomic_thread_fence(std::memory_order_release);
+        version.store(format_version, std::memory_order_relaxed);
+        geometry.store(expected);
+        magic.store(magic_value, std::memory_order_relaxed);
+    }
+
+    // Publishes the initialized ring, returns its generation
+    auto
+    end_initialize() noexcept -> std::uint64_t
+    {
+        std::uint64_t const current = generation.fetch_add(1, std::memory_order_relaxed) + 1;
+        state.store(ready, std::memory_order_release);
+        return current;
+    }
+
+    // Returns the generation of a ready segment built for `expected`. Throws
+    // abc_error(errc::shared_memory_not_ready) while the segment is not (or only partially)
+    // initialized, abc_error(errc::shared_memory_layout_mismatch) when it holds something else.
+    auto
+    validate(SharedRingGeometry const & expected) const -> std::uint64_t
+    {
+        std::uint64_t const found = magic.load(std::memory_order_relaxed);
+        if (found != 0 && found != magic_value)
+        {
+            throw_error(make_error_code(errc::shared_memory_layout_mismatch));
+        }
+        if (found == 0 || state.load(std::memory_order_acquire) != ready)
+        {
+            throw_error(make_error_code(errc::shared_memory_not_ready));
+        }
+
+        std::uint64_t const current = generation.load(std::memory_order_relaxed);
+        std::uint32_t const found_version = version.load(std::memory_order_relaxed);
+        SharedRingGeometry const found_geometry = geometry.load();
+
+        // A re-initialization started meanwhile may have mixed old and new fields, check again
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (state.load(std::memory_order_acquire) != ready || generation.load(std::memory_order_relaxed) != current)
+        {
+            throw_error(make_error_code(errc::shared_memory_not_ready));
+        }
+        if (found_version != format_version || found_geometry != expected)
+        {
+            throw_error(make_error_code(errc::shared_memory_layout_mismatch));
+        }
+        return current;
+    }
+
+    // True when the ring of `attached` generation is no longer the one in the segment
+    auto
+    stale(std::uint64_t const attached) const noexcept -> bool
+    {
+        return state.load(std::memory_order_acquire) != ready || generation.load(std::memory_order_relaxed) != attached;
+    }
+};
+
+} // namespace abc::async::details
+
+#endif // ABC_INCLUDE_ABC_ASYNC_DETAILS_SHARED_RING_HEADER
@@ -0,0 +1,260 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_DETAILS_TIMED_PARK_AWAITER
+#define ABC_INCLUDE_ABC_ASYNC_DETAILS_TIMED_PARK_AWAITER
+
+#pragma once
+
+#include "waiter_list.h"
+
+#include "abc/async/timer_service.h"
+
+#include <stdexec/execution.hpp>
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <coroutine>
+#include <optional>
+
+namespace abc::async::details
+{
+
+// Awaiter parking the calling coroutine on a waiter list, like ParkAwaiter, but only until
+// `deadline`: a timer on the default TimerService races the notification. await_resume() returns
+// true when the list was notified (or `(owner->*ready)()` held while parking), false on timeout.
+//
+// The first of the two to fire wins. A notification wins by stopping the timer; a timeout wins
+// by withdrawing the waiter, and when a notifier took the waiter meanwhile, that wakeup is
+// handed on to the next waiter of the list. The coroutine is resumed through `scheduler` only
+// once both the waiter and the timer are settled, so neither can touch a destroyed awaiter.
+template <typename Owner, stdexec::scheduler Scheduler>
+class TimedParkAwaiter : public Waiter
+{
+private:
+    using timer_sender = TimerScheduler<std::chrono::steady_clock>::sender_type;
+
+    struct ResumeReceiver
+    {
+        using receiver_concept = stdexec::receiver_t;
+
+        TimedParkAwaiter * awaiter_;
+
+        auto
+        set_value() noexcept -> void
+        {
+            awaiter_->continuation_.resume();
+        }
+
+        template <typename Error>
+        auto
+        set_error(Error &&) noexcept -> void
+        {
+            // The scheduler failed to hop, resume in place and let the caller retry its operation
+            awaiter_->continuation_.resume();
+        }
+
+        auto
+        set_stopped() noexcept -> void
+        {
+            awaiter_->continuation_.resume();
+        }
+
+        auto
+        get_env() const noexcept -> stdexec::env<>
+        {
+            return {};
+        }
+    };
+
+    struct TimerEnv
+    {
+        stdexec::inplace_stop_token token_;
+
+        auto
+        query(stdexec::get_stop_token_t) const noexcept -> stdexec::inplace_stop_token
+        {
+            return token_;
+        }
+    };
+
+    struct TimerReceiver
+    {
+        using receiver_concept = stdexec::receiver_t;
+
+        TimedParkAwaiter * awaiter_;
+
+        auto
+        set_value() noexcept -> void
+        {
+            awaiter_->on_timer();
+        }
+
+        auto
+        set_stopped() noexcept -> void
+        {
+            // Stopped by a notification, or by the service shutting down
+            awaiter_->on_timer();
+        }
+
+        auto
+        get_env() const noexcept -> TimerEnv
+        {
+            return TimerEnv{ awaiter_->timer_stop_.get_token() };
+        }
+    };
+
+    using resume_operation = stdexec::connect_result_t<stdexec::schedule_result_t<Scheduler &>, ResumeReceiver>;
+    using timer_operation = stdexec::connect_result_t<timer_sender, TimerReceiver>;
+
+    Scheduler * scheduler_;
+    WaiterList * list_;
+    Owner const * owner_;
+    bool (Owner::*ready_)() const noexcept;
+    std::chrono::steady_clock::time_point deadline_;
+
+    std::atomic<bool> fired_{ false };
+    bool notified_{ true };
+
+    // The parked waiter and the timer not yet settled, plus one while await_suspend() runs
+    std::atomic<int> outstanding_{ 0 };
+
+    stdexec::inplace_stop_source timer_stop_{};
+    std::coroutine_handle<> continuation_{};
+    std::optional<timer_operation> timer_{};
+    std::optional<resume_operation> resume_{};
+
+    auto
+    fire(bool const notified) noexcept -> bool
+    {
+        if (fired_.exchange(true, std::memory_order_acq_rel))
+        {
+            return false;
+        }
+
+        notified_ = notified;
+        return true;
+    }
+
+    auto
+    settle() noexcept -> void
+    {
+        if (outstanding_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            resume_on_scheduler();
+        }
+    }
+
+    auto
+    resume_on_scheduler() noexcept -> void
+    {
+        // Operation states are immovable, so build it in place from the connect() result
+        struct Connect
+        {
+            TimedParkAwaiter * self;
+
+            operator resume_operation() const
+            {
+                return stdexec::connect(stdexec::schedule(*self->scheduler_), ResumeReceiver{ self });
+            }
+        };
+
+        stdexec::start(resume_.emplace(Connect{ this }));
+    }
+
+    static auto
+    on_notified(Waiter * waiter) noexcept -> void
+    {
+        auto * self = static_cast<TimedParkAwaiter *>(waiter);
+        if (self->fire(true))
+        {
+            self->timer_stop_.request_stop();
+        }
+        else
+        {
+            // Timed out already, pass the wakeup on to whoever else waits here
+            self->list_->notify_one();
+        }
+        self->settle();
+    }
+
+    auto
+    on_timer() noexcept -> void
+    {
+        // A waiter a notifier already took is settled by on_notified()
+        if (fire(false) && list_->withdraw(this))
+        {
+            outstanding_.fetch_sub(1, std::memory_order_relaxed);
+        }
+        settle();
+    }
+
+public:
+    TimedParkAwaiter(Scheduler & scheduler,
+                     WaiterList & list,
+                     Owner const * owner,
+                     bool (Owner::*ready)() const noexcept,
+                     std::chrono::steady_clock::time_point const deadline) noexcept
+        : scheduler_{ &scheduler }, list_{ &list }, owner_{ owner }, ready_{ ready }, deadline_{ deadline }
+    {
+        this->resume_fn = &TimedParkAwaiter::on_notified;
+    }
+
+    // Awaiters may be moved into the coroutine frame before they are awaited, never after
+    TimedParkAwaiter(TimedParkAwaiter && other) noexcept
+        : TimedParkAwaiter{ *other.scheduler_, *other.list_, other.owner_, other.ready_, other.deadline_ }
+    {
+        assert(!other.timer_.has_value());
+    }
+
+    TimedParkAwaiter(TimedParkAwaiter const &) = delete;
+    auto operator=(TimedParkAwaiter const &) -> TimedParkAwaiter & = delete;
+    auto operator=(TimedParkAwaiter &&) -> TimedParkAwaiter & = delete;
+
+    auto
+    await_ready() const noexcept -> bool
+    {
+        return false;
+    }
+
+    auto
+    await_suspend(std::coroutine_handle<> continuation) -> bool
+    {
+        continuation_ = continuation;
+        outstanding_.store(2, std::memory_order_relaxed);
+
+        Owner const * owner = owner_;
+        auto ready = ready_;
+        if (!list_->park(this, [owner, ready] { return (owner->*ready)(); }))
+        {
+            return false;
+        }
+
+        // Members stay valid while the guard count is held: whoever settles last resumes the
+        // coroutine, and when that is this call, it simply does not suspend
+        struct Connect
+        {
+            TimedParkAwaiter * self;
+
+            operator timer_operation() const
+            {
+                return stdexec::connect(sleep_until(self->deadline_), TimerReceiver{ self });
+            }
+        };
+
+        outstanding_.fetch_add(1, std::memory_order_relaxed);
+        stdexec::start(timer_.emplace(Connect{ this }));
+        return outstanding_.fetch_sub(1, std::memory_order_acq_rel) != 1;
+    }
+
+    auto
+    await_resume() const noexcept -> bool
+    {
+        return notified_;
+    }
+};
+
+} // namespace abc::async::details
+
+#endif // ABC_INCLUDE_ABC_ASYNC_DETAILS_TIMED_PARK_AWAITER
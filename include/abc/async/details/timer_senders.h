@@ -0,0 +1,190 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_DETAILS_TIMER_SENDERS
+#define ABC_INCLUDE_ABC_ASYNC_DETAILS_TIMER_SENDERS
+
+#pragma once
+
+#include "abc/timing_wheel.h"
+
+#include <stdexec/execution.hpp>
+
+#include <optional>
+#include <utility>
+
+namespace abc::async::details
+{
+
+// Timer queued on a TimerService, embedded in the operation state waiting for it
+struct TimerNode : timing_wheel_node
+{
+    // Completes the operation, on the service thread, with set_stopped when `stopped`, with
+    // set_value otherwise
+    void (*complete_fn)(TimerNode *, bool stopped) noexcept { nullptr };
+
+    // Stop was requested before the node reached the wheel; guarded by the service mutex
+    bool stop_requested{ false };
+};
+
+// When a timer is due: at a fixed time, or a delay after its operation was started, so that a
+// sender connected late or started again (retry, repeat) still waits the whole delay
+template <typename Clock>
+class TimerDeadline
+{
+private:
+    using time_point = typename Clock::time_point;
+    using duration = typename Clock::duration;
+
+    time_point at_{};
+    duration after_{};
+    bool relative_{ false };
+
+public:
+    static auto
+    at(time_point const deadline) noexcept -> TimerDeadline
+    {
+        TimerDeadline result;
+        result.at_ = deadline;
+        return result;
+    }
+
+    static auto
+    after(duration const delay) noexcept -> TimerDeadline
+    {
+        TimerDeadline result;
+        result.after_ = delay;
+        result.relative_ = true;
+        return result;
+    }
+
+    // The absolute deadline, for an operation starting now
+    auto
+    resolve() const noexcept -> time_point
+    {
+        return relative_ ? Clock::now() + after_ : at_;
+    }
+};
+
+template <typename Service, typename Receiver>
+class TimerOperation : public TimerNode
+{
+private:
+    using deadline_type = TimerDeadline<typename Service::clock_type>;
+    using stop_token_type = stdexec::stop_token_of_t<stdexec::env_of_t<Receiver>>;
+
+    struct OnStop
+    {
+        TimerOperation * operation_;
+
+        auto
+        operator()() const noexcept -> void
+        {
+            operation_->service_->cancel(operation_);
+        }
+    };
+
+    Service * service_;
+    deadline_type deadline_;
+    Receiver receiver_;
+    std::optional<stdexec::stop_callback_for_t<stop_token_type, OnStop>> on_stop_{};
+
+    static auto
+    complete(TimerNode * node, bool const stopped) noexcept -> void
+    {
+        auto * self = static_cast<TimerOperation *>(node);
+
+        // Waits for a stop callback running on another thread, which no longer finds the node
+        self->on_stop_.reset();
+        if (stopped)
+        {
+            stdexec::set_stopped(std::move(self->receiver_));
+        }
+        else
+        {
+            stdexec::set_value(std::move(self->receiver_));
+        }
+    }
+
+public:
+    using operation_state_concept = stdexec::operation_state_t;
+
+    TimerOperation(Service * service, deadline_type const deadline, Receiver && receiver)
+        : service_{ service }, deadline_{ deadline }, receiver_{ std::move(receiver) }
+    {
+        this->complete_fn = &TimerOperation::complete;
+    }
+
+    TimerOperation(TimerOperation const &) = delete;
+    auto operator=(TimerOperation const &) -> TimerOperation & = delete;
+    TimerOperation(TimerOperation &&) = delete;
+    auto operator=(TimerOperation &&) -> TimerOperation & = delete;
+
+    auto
+    start() noexcept -> void
+    {
+        if constexpr (!stdexec::unstoppable_token<stop_token_type>)
+        {
+            auto token = stdexec::get_stop_token(stdexec::get_env(receiver_));
+            if (token.stop_requested())
+            {
+                stdexec::set_stopped(std::move(receiver_));
+                return;
+            }
+
+            // Registered before the node is queued: a stop arriving in between flags the node,
+            // and submit() then completes it as stopped right away
+            on_stop_.emplace(token, OnStop{ this });
+        }
+        service_->submit(this, deadline_.resolve());
+    }
+};
+
+// Sender completing on the service thread once `deadline` has passed, or with set_stopped when
+// stop is requested (or the service shuts down) first. A relative deadline is resolved by every
+// operation's start(), so the sender can be connected and started any number of times.
+template <typename Service>
+class TimerSender
+{
+private:
+    using deadline_type = TimerDeadline<typename Service::clock_type>;
+
+    struct Env
+    {
+        Service * service_;
+
+        auto
+        query(stdexec::get_completion_scheduler_t<stdexec::set_value_t>) const noexcept
+        {
+            return service_->get_scheduler();
+        }
+    };
+
+    Service * service_;
+    deadline_type deadline_;
+
+public:
+    using sender_concept = stdexec::sender_t;
+    using completion_signatures = stdexec::completion_signatures<stdexec::set_value_t(), stdexec::set_stopped_t()>;
+
+    TimerSender(Service * service, deadline_type const deadline) noexcept : service_{ service }, deadline_{ deadline }
+    {
+    }
+
+    template <stdexec::receiver Receiver>
+    auto
+    connect(Receiver receiver) const -> TimerOperation<Service, Receiver>
+    {
+        return TimerOperation<Service, Receiver>{ service_, deadline_, std::move(receiver) };
+    }
+
+    auto
+    get_env() const noexcept -> Env
+    {
+        return Env{ service_ };
+    }
+};
+
+} // namespace abc::async::details
+
+#endif // ABC_INCLUDE_ABC_ASYNC_DETAILS_TIMER_SENDERS
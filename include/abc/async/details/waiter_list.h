@@ -0,0 +1,198 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_DETAILS_WAITER_LIST
+#define ABC_INCLUDE_ABC_ASYNC_DETAILS_WAITER_LIST
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+namespace abc::async::details
+{
+
+// Intrusive node for a suspended operation. The owner provides `resume_fn`, which is invoked
+// exactly once by whoever takes the node off the list.
+struct Waiter
+{
+    Waiter * next{ nullptr };
+    void (*resume_fn)(Waiter *) noexcept { nullptr };
+
+    auto
+    resume() noexcept -> void
+    {
+        resume_fn(this);
+    }
+};
+
+// FIFO of suspended waiters. Waiters park themselves with `park()` and are handed back by
+// `notify_one()` / `notify_all()`. The lock is only touched when somebody is actually waiting,
+// so the fast path of a notifier is a fence plus one relaxed load.
+class WaiterList
+{
+private:
+    std::mutex mutex_;
+    Waiter * head_{ nullptr };
+    Waiter * tail_{ nullptr };
+    std::atomic<std::size_t> size_{ 0 };
+
+public:
+    WaiterList() = default;
+
+    WaiterList(WaiterList const &) = delete;
+    auto operator=(WaiterList const &) -> WaiterList & = delete;
+    WaiterList(WaiterList &&) = delete;
+    auto operator=(WaiterList &&) -> WaiterList & = delete;
+
+    // Appends `waiter` and then re-evaluates `ready`. If the condition the waiter sleeps on has
+    // already become true, the waiter is withdrawn and false is returned: the caller must not
+    // suspend. Otherwise returns true and the waiter will be resumed by a later notify.
+    template <typename Predicate>
+    auto
+    park(Waiter * waiter, Predicate && ready) -> bool
+    {
+        std::lock_guard<std::mutex> lock{ mutex_ };
+
+        Waiter * previous_tail = tail_;
+        waiter->next = nullptr;
+        if (tail_ != nullptr)
+        {
+            tail_->next = waiter;
+        }
+        else
+        {
+            head_ = waiter;
+        }
+        tail_ = waiter;
+        size_.fetch_add(1, std::memory_order_seq_cst);
+
+        // Pairs with the fence in notify_one(): either the notifier sees this waiter, or this
+        // check sees the state the notifier published.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!ready())
+        {
+            return true;
+        }
+
+        // Still the tail since the lock was never released.
+        tail_ = previous_tail;
+        if (previous_tail != nullptr)
+        {
+            previous_tail->next = nullptr;
+        }
+        else
+        {
+            head_ = nullptr;
+        }
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Takes `waiter` off the list if it is still parked. Returns false when a notifier has
+    // already taken it, in which case it is being resumed.
+    auto
+    withdraw(Waiter * waiter) -> bool
+    {
+        std::lock_guard<std::mutex> lock{ mutex_ };
+
+        Waiter * previous = nullptr;
+        for (Waiter * current = head_; current != nullptr; previous = current, current = current->next)
+        {
+            if (current != waiter)
+            {
+                continue;
+            }
+
+            if (previous != nullptr)
+            {
+                previous->next = current->next;
+            }
+            else
+            {
+                head_ = current->next;
+            }
+            if (tail_ == current)
+            {
+                tail_ = previous;
+            }
+            size_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    // Resumes the oldest waiter, if any. Must be called after the state change it announces
+    // has been published.
+    auto
+    notify_one() -> bool
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (size_.load(std::memory_order_relaxed) == 0)
+        {
+            return false;
+        }
+
+        Waiter * waiter = nullptr;
+        {
+            std::lock_guard<std::mutex> lock{ mutex_ };
+            waiter = head_;
+            if (waiter == nullptr)
+            {
+                return false;
+            }
+
+            head_ = waiter->next;
+            if (head_ == nullptr)
+            {
+                tail_ = nullptr;
+            }
+            size_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        waiter->resume();
+        return true;
+    }
+
+    // Resumes every waiter parked so far. Returns how many were resumed.
+    auto
+    notify_all() -> std::size_t
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (size_.load(std::memory_order_relaxed) == 0)
+        {
+            return 0;
+        }
+
+        Waiter * waiter = nullptr;
+        {
+            std::lock_guard<std::mutex> lock{ mutex_ };
+            waiter = head_;
+            head_ = nullptr;
+            tail_ = nullptr;
+            size_.store(0, std::memory_order_relaxed);
+        }
+
+        // A resumed waiter may be destroyed right away, read its successor first
+        std::size_t count = 0;
+        while (waiter != nullptr)
+        {
+            Waiter * next = waiter->next;
+            waiter->resume();
+            waiter = next;
+            ++count;
+        }
+        return count;
+    }
+
+    auto
+    empty() const noexcept -> bool
+    {
+        return size_.load(std::memory_order_acquire) == 0;
+    }
+};
+
+} // namespace abc::async::details
+
+#endif // ABC_INCLUDE_ABC_ASYNC_DETAILS_WAITER_LIST
@@ -0,0 +1,275 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_PRIORITY_QUEUE
+#define ABC_INCLUDE_ABC_ASYNC_PRIORITY_QUEUE
+
+#pragma once
+
+#include "priority_queue_decl.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace abc::async
+{
+
+template <typename T, stdexec::scheduler Scheduler, typename Compare>
+bool
+PriorityQueue<T, Scheduler, Compare>::Heap::try_lock() noexcept
+{
+    return !locked.load(std::memory_order_relaxed) && !locked.exchange(true, std::memory_order_acquire);
+}
+
+template <typename T, stdexec::scheduler Scheduler, typename Compare>
+void
+PriorityQueue<T, Scheduler, Compare>::Heap::unlock() noexcept
+{
+    locked.store(false, std::memory_order_release);
+}
+
+template <typename T, stdexec::scheduler Scheduler, typename Compare>
+PriorityQueue<T, Scheduler, Compare>::PriorityQueue(Scheduler scheduler, std::size_t const heap_count, Compare compare)
+    : compare_{ std::move(compare) }, scheduler_{ scheduler }
+{
+    heaps_.reserve(std::max<std::size_t>(heap_count, 1));
+    for (std::size_t i = 0; i < std::max<std::size_t>(heap_count, 1); ++i)
+    {
+        heaps_.push_back(std::make_unique<Heap>());
+    }
+}
+
+template <typename T, stdexec::scheduler Scheduler, typename Compare>
+std::size_t
+PriorityQueue<T, Scheduler, Compare>::thread_slot() noexcept
+{
+    static std::atomic<std::size_t> next_slot{ 0 };
+    thread_local std::size_t const slot = next_slot.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
+
+template <typename T, stdexec::scheduler Scheduler, typename Compare>
+std::uint64_t
+PriorityQueue<T, Scheduler, Compare>::next_random() noexcept
+{
+    // Seeded from the slot so that threads start out on different heaps
+    thread_local std::uint64_t state = (thread_slot() + 1) * 0x9E3779B97F4A7C15ull;
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+template <typename T, stdexec::scheduler Scheduler, typename Compare>
+auto
+PriorityQueue<T, Scheduler, Compare>::random_heap() noexcept -> Heap &
+{
+    return *heaps_[static_cast<std::size_t>(next_random() % heaps_.size())];
+}
+
+template <typename T, stdexec::scheduler Scheduler, typename Compare>
+bool
+PriorityQueue<T, Scheduler, Compare>::can_pop() const noexcept
+{
+    return !empty();
+}
+
+template <typename T, stdexec::scheduler Scheduler, typename Compare>
+auto
+PriorityQueue<T, Scheduler, Compare>::lock_random_heap() noexcept -> Heap &
+{
+    while (true)
+    {
+        Heap & heap = random_heap();
+        if (heap.try_lock())
+        {
+            return heap;
+        }
+    }
+}
+
+template <typename T, stdexec::scheduler Scheduler, typename Compare>
+T
+PriorityQueue<T, Scheduler, Compare>::pop_locked(Heap & heap)
+{
+    std::pop_heap(heap.items.begin(), heap.items.end(), HeapOrder{ &compare_ });
+    T item = std::move(heap.items.back());
+    heap.items.pop_back();
+    heap.size.store(heap.items.size(), std::memory_order_relaxed);
+    size_.fetch_sub(1, std::memory_order_release);
+    heap.unlock();
+    return item;
+}
+
+template <typename T, stdexec::scheduler Scheduler, typename Compare>
+void
+PriorityQueue<T, Scheduler, Compare>::wake_consumers(std::size_t count)
+{
+    while (count-- != 0 && consumers_.notify_one())
+    {
+    }
+}
+
+template <typename T, stdexec::scheduler Scheduler, typename Compare>
+void
+PriorityQueue<T, Scheduler, Compare>::push(T && item)
+{
+    Heap & heap = lock_random_heap();
+    try
+    {
+        heap.items.push_back(std::move(item));
+    }
+    catch (...)
+    {
+        heap.unlock();
+        throw;
+    }
+    std::push_heap(heap.items.begin(), heap.items.end(), HeapOrder{ &compare_ });
+    heap.size.store(heap.items.size(), std::memory_order_relaxed);
+    size_.fetch_add(1, std::memory_order_acq_rel);
+    heap.unlock();
+
+    wake_consumers(1);
+}
+
+template <typename T, stdexec::scheduler Scheduler, typename Compare>
+void
+PriorityQueue<T, Scheduler, Compare>::push(T const & item)
+{
+    push(T{ item });
+}
+
+template <typename T, stdexec::scheduler Scheduler, typename Compare>
+void
+PriorityQueue<T, Scheduler, Compare>::push_bulk(std::span<T> items)
+{
+    std::size_t pushed = 0;
+    while (pushed != items.size())
+    {
+        std::size_t const count = std::min(bulk_chunk_size, items.size() - pushed);
+
+        Heap & heap = lock_random_heap();
+        try
+        {
+            heap.items.reserve(heap.items.size() + count);
+        }
+        catch (...)
+        {
+            heap.unlock();
+            wake_consumers(pushed);
+            throw;
+        }
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            heap.items.push_back(std::move(items[pushed + i]));
+            std::push_heap(heap.items.begin(), heap.items.end(), HeapOrder{ &compare_ });
+        }
+        heap.size.store(heap.items.size(), std::memory_order_relaxed);
+        size_.fetch_add(count, std::memory_order_acq_rel);
+        heap.unlock();
+
+        pushed += count;
+    }
+
+    wake_consumers(pushed);
+}
+
+template <typename T, stdexec::scheduler Scheduler, typename Compare>
+auto
+PriorityQueue<T, Scheduler, Compare>::try_pop() -> std::optional<T>
+{
+    if (size_.load(std::memory_order_acquire) == 0)
+    {
+        return std::nullopt;
+    }
+
+    // Two choices: the better top of two random heaps
+    for (std::size_t attempt = 0; attempt != 2 * heaps_.size(); ++attempt)
+    {
+        Heap * first = &random_heap();
+        Heap * second = &random_heap();
+        if (first->size.load(std::memory_order_relaxed) == 0)
+        {
+            std::swap(first, second);
+        }
+        if (first->size.load(std::memory_order_relaxed) == 0 || !first->try_lock())
+        {
+            continue;
+        }
+
+        if (second != first && second->size.load(std::memory_order_relaxed) != 0 && second->try_lock())
+        {
+            bool const take_second =
+                !second->items.empty() && (first->items.empty() || compare_(second->items.front(), first->items.front()));
+            (take_second ? first : second)->unlock();
+            if (take_second)
+            {
+                first = second;
+            }
+        }
+
+        if (!first->items.empty())
+        {
+            return pop_locked(*first);
+        }
+        first->unlock();
+    }
+
+    // Few heaps hold items and sampling kept missing them: visit every heap once, waiting for
+    // the ones holding items to be free, so that std::nullopt means each was empty when visited
+    for (auto & heap : heaps_)
+    {
+        while (heap->size.load(std::memory_order_relaxed) != 0)
+        {
+            if (heap->try_lock())
+            {
+                if (!heap->items.empty())
+                {
+                    return pop_locked(*heap);
+                }
+                heap->unlock();
+                break;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+template <typename T, stdexec::scheduler Scheduler, typename Compare>
+auto
+PriorityQueue<T, Scheduler, Compare>::async_pop() -> exec::task<T>
+{
+    while (true)
+    {
+        if (auto item = try_pop())
+        {
+            co_return std::move(*item);
+        }
+        co_await Awaiter{ scheduler_, consumers_, this, &PriorityQueue::can_pop };
+    }
+}
+
+template <typename T, stdexec::scheduler Scheduler, typename Compare>
+bool
+PriorityQueue<T, Scheduler, Compare>::empty() const noexcept
+{
+    return size_.load(std::memory_order_acquire) == 0;
+}
+
+template <typename T, stdexec::scheduler Scheduler, typename Compare>
+std::size_t
+PriorityQueue<T, Scheduler, Compare>::size() const noexcept
+{
+    return size_.load(std::memory_order_acquire);
+}
+
+template <typename T, stdexec::scheduler Scheduler, typename Compare>
+std::size_t
+PriorityQueue<T, Scheduler, Compare>::heap_count() const noexcept
+{
+    return heaps_.size();
+}
+
+} // namespace abc::async
+
+#endif // ABC_INCLUDE_ABC_ASYNC_PRIORITY_QUEUE
@@ -0,0 +1,139 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_PRIORITY_QUEUE_DECL
+#define ABC_INCLUDE_ABC_ASYNC_PRIORITY_QUEUE_DECL
+
+#pragma once
+
+#include "priority_queue_fwd_decl.h"
+
+#include "details/park_awaiter.h"
+#include "details/waiter_list.h"
+
+#include <exec/task.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace abc::async
+{
+
+// Unbounded, relaxed concurrent priority queue (a MultiQueue): items are spread over several
+// independent binary heaps, each behind its own try-lock, so that threads rarely meet on the
+// same heap. Pops return the item that compares lowest under `Compare` (e.g. the earliest
+// deadline), up to the relaxation below.
+//
+// push() inserts into a randomly chosen heap. try_pop() locks two randomly chosen heaps and takes
+// the better of their tops; a thread finding a heap locked picks another one instead of waiting.
+// Relaxation bound: with H heaps, the popped item is in expectation among the O(H) best queued
+// items (about H for the two-choice rule), independent of the number of queued items and of
+// the number of threads. Items pushed by one thread are not necessarily popped in order even
+// with equal keys. `heap_count == 1` makes the queue exact, at the price of a single lock.
+//
+// try_pop() returns std::nullopt only after every heap was found empty, never because of the
+// relaxation; an item pushed to an already visited heap meanwhile is left for the next call.
+template <typename T, stdexec::scheduler Scheduler, typename Compare>
+class PriorityQueue
+{
+private:
+    static constexpr std::size_t cache_line_size_in_bytes = 64; // Assuming 64-byte cache line size
+
+    // push_bulk() hands each heap this many items per lock acquisition
+    static constexpr std::size_t bulk_chunk_size = 16;
+
+    struct alignas(cache_line_size_in_bytes) Heap
+    {
+        std::atomic<bool> locked{ false };
+
+        // Mirrors items.size(), readable without the lock
+        std::atomic<std::size_t> size{ 0 };
+        std::vector<T> items;
+
+        auto try_lock() noexcept -> bool;
+        auto unlock() noexcept -> void;
+    };
+
+    // Orders the std::*_heap algorithms so that the lowest item is at the front
+    struct HeapOrder
+    {
+        Compare const * compare;
+
+        auto
+        operator()(T const & lhs, T const & rhs) const -> bool
+        {
+            return (*compare)(rhs, lhs);
+        }
+    };
+
+    std::vector<std::unique_ptr<Heap>> heaps_;
+    [[no_unique_address]] Compare compare_;
+
+    // Counted under the heap's lock once an item is inserted or removed, so a non-zero count
+    // always stands for items that are in a heap
+    alignas(cache_line_size_in_bytes) std::atomic<std::size_t> size_{ 0 };
+
+    // Suspended consumers waiting for an item
+    alignas(cache_line_size_in_bytes) details::WaiterList consumers_;
+
+    Scheduler scheduler_;
+
+    using Awaiter = details::ParkAwaiter<PriorityQueue, Scheduler>;
+
+    // Process-wide index of the calling thread, assigned on first use
+    static auto thread_slot() noexcept -> std::size_t;
+
+    // Per-thread xorshift generator choosing the heaps
+    static auto next_random() noexcept -> std::uint64_t;
+
+    auto random_heap() noexcept -> Heap &;
+
+
+    auto can_pop() const noexcept -> bool;
+
+    // Locks a random heap, retrying on other heaps while the chosen ones are busy
+    auto lock_random_heap() noexcept -> Heap &;
+
+    // Pops the top of a locked, non-empty heap and unlocks it
+    auto pop_locked(Heap & heap) -> T;
+
+    auto wake_consumers(std::size_t count) -> void;
+
+public:
+    // `heap_count` defaults to twice the number of hardware threads; 0 is treated as 1
+    explicit PriorityQueue(Scheduler scheduler, std::size_t heap_count = 2 * std::thread::hardware_concurrency(), Compare compare = Compare{});
+
+    // Non-copyable, non-movable
+    PriorityQueue(PriorityQueue const &) = delete;
+    auto operator=(PriorityQueue const &) -> PriorityQueue & = delete;
+    PriorityQueue(PriorityQueue &&) = delete;
+    auto operator=(PriorityQueue &&) -> PriorityQueue & = delete;
+    ~PriorityQueue() = default;
+
+    auto push(T && item) -> void;
+    auto push(T const & item) -> void;
+
+    // Pushes every item, moved from, taking each heap's lock once per chunk of items
+    auto push_bulk(std::span<T> items) -> void;
+
+    // One of the lowest items (see the relaxation bound above), std::nullopt when one sweep over
+    // the heaps found none
+    auto try_pop() -> std::optional<T>;
+
+    // try_pop() waiting (parked) while the queue is empty
+    auto async_pop() -> exec::task<T>;
+
+    // Query operations. With concurrent operations the results are only a snapshot.
+    auto empty() const noexcept -> bool;
+    auto size() const noexcept -> std::size_t;
+    auto heap_count() const noexcept -> std::size_t;
+};
+
+} // namespace abc::async
+
+#endif // ABC_INCLUDE_ABC_ASYNC_PRIORITY_QUEUE_DECL
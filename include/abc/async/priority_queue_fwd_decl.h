@@ -0,0 +1,21 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_PRIORITY_QUEUE_FWD_DECL
+#define ABC_INCLUDE_ABC_ASYNC_PRIORITY_QUEUE_FWD_DECL
+
+#pragma once
+
+#include <stdexec/execution.hpp>
+
+#include <functional>
+
+namespace abc::async
+{
+
+template <typename T, stdexec::scheduler Scheduler, typename Compare = std::less<T>>
+class PriorityQueue;
+
+}
+
+#endif // ABC_INCLUDE_ABC_ASYNC_PRIORITY_QUEUE_FWD_DECL
@@ -9,226 +9,686 @@
 #include "queue_decl.h"
 
 #include "abc/error.h"
+#include "abc/scope_guard.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
 
 namespace abc::async
 {
 
-template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler>
-Queue<T, Capacity, Scheduler>::Queue(Scheduler scheduler) : scheduler_{ scheduler }
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::Queue(Scheduler scheduler)
+    requires(Capacity != std::dynamic_extent)
+    : scheduler_{ scheduler }
 {
     static_assert(Capacity > 0, "Queue capacity must be greater than 0");
     static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::Queue(Scheduler scheduler, std::size_t const capacity)
+    requires(Capacity == std::dynamic_extent)
+    : buffer_{ validated_capacity(capacity) }, scheduler_{ scheduler }
+{
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::~Queue()
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        // Destroy the items nobody dequeued
+        std::size_t const tail = tail_.load(std::memory_order_acquire);
+        for (std::size_t pos = head_.load(std::memory_order_acquire); pos != tail; ++pos)
+        {
+            std::destroy_at(item_at(pos));
+        }
+    }
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+std::size_t
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::validated_capacity(std::size_t const capacity)
+{
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0)
+    {
+        throw_error(make_error_code(errc::invalid_queue_capacity));
+    }
+
+    return capacity;
+}
 
-    // Initialize all sequence numbers
-    for (size_t i = 0; i < Capacity; ++i)
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+typename Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::Cell &
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::cell_at(std::size_t const pos) noexcept
+{
+    return buffer_[physical_index(pos & (capacity() - 1))];
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+typename Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::Cell const &
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::cell_at(std::size_t const pos) const noexcept
+{
+    return buffer_[physical_index(pos & (capacity() - 1))];
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+std::size_t
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::physical_index(std::size_t const index) const noexcept
+{
+    if constexpr (cells_per_line == 1)
     {
-        buffer_[i].sequence.store(i, std::memory_order_relaxed);
+        return index;
+    }
+    else
+    {
+        // Rings smaller than a single line have nothing to stripe over
+        std::size_t const lines = capacity() / cells_per_line;
+        if (lines <= 1)
+        {
+            return index;
+        }
+        return (index & (lines - 1)) * cells_per_line + (index >> std::countr_zero(lines));
     }
 }
 
-template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler>
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+std::size_t
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::load_sequence(std::size_t const pos) const noexcept
+{
+    std::size_t const index = pos & (capacity() - 1);
+    return std::atomic_ref<std::size_t>{ cell_at(pos).sequence }.load(std::memory_order_acquire) + index;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+void
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::store_sequence(std::size_t const pos, std::size_t const sequence) noexcept
+{
+    std::size_t const index = pos & (capacity() - 1);
+    std::atomic_ref<std::size_t>{ cell_at(pos).sequence }.store(sequence - index, std::memory_order_release);
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
 bool
-Queue<T, Capacity, Scheduler>::empty() const noexcept
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::empty() const noexcept
 {
     return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
 }
 
-template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler>
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
 bool
-Queue<T, Capacity, Scheduler>::full() const noexcept
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::full() const noexcept
 {
     std::size_t head = head_.load(std::memory_order_acquire);
     std::size_t tail = tail_.load(std::memory_order_acquire);
-    return (tail - head) == Capacity;
+    return (tail - head) == capacity();
 }
 
-template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler>
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
 std::size_t
-Queue<T, Capacity, Scheduler>::size() const noexcept
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::size() const noexcept
 {
     std::size_t head = head_.load(std::memory_order_acquire);
     std::size_t tail = tail_.load(std::memory_order_acquire);
     return tail - head;
 }
 
-template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler>
-bool
-Queue<T, Capacity, Scheduler>::enqueue(T && item)
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+std::pair<std::size_t, std::size_t>
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::claim_for_enqueue(std::size_t const count) noexcept
 {
     std::size_t pos = tail_.load(std::memory_order_relaxed);
 
-    for (;;)
+    if constexpr (!sequenced)
     {
-        // Get the cell at the current position
-        Cell * cell = &buffer_[pos & (Capacity - 1)];
-        std::size_t seq = cell->sequence.load(std::memory_order_acquire);
-        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
-
-        if (diff == 0)
+        // SPSC: the producer owns tail_, only look at the consumer's index when the cached
+        // copy says there is not enough room
+        std::size_t free = capacity() - (pos - cached_head_);
+        if (free < count)
         {
-            // Cell is available, try to claim it
-            if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            cached_head_ = head_.load(std::memory_order_acquire);
+            free = capacity() - (pos - cached_head_);
+        }
+        return { pos, std::min(count, free) };
+    }
+    else
+    {
+        for (;;)
+        {
+            // Count the free cells following the current position; a cell is free for sequence
+            // number `pos + n` exactly when its own sequence equals it
+            std::size_t claimed = 0;
+            intptr_t diff = 0;
+            while (claimed < count)
+            {
+                std::size_t seq = load_sequence(pos + claimed);
+                diff = (intptr_t)seq - (intptr_t)(pos + claimed);
+                if (diff != 0)
+                {
+                    break;
+                }
+                ++claimed;
+            }
+
+            if (claimed == 0 && diff < 0)
+            {
+                // Queue is full
+                return { pos, 0 };
+            }
+
+            if constexpr (!multi_producer)
+            {
+                // The only producer: nobody can race for these cells
+                tail_.store(pos + claimed, std::memory_order_relaxed);
+                return { pos, claimed };
+            }
+            else
             {
-                // Store the data
-                cell->data = std::move(item);
-                // Make the data available to consumers
-                cell->sequence.store(pos + 1, std::memory_order_release);
-                unfinished_.fetch_add(1, std::memory_order_release);
-                return true;
+                // Claim the whole run at once; nobody else can touch these cells unless tail_ moved
+                if (claimed == 0)
+                {
+                    // Another thread claimed the cell, get updated position
+                    pos = tail_.load(std::memory_order_relaxed);
+                }
+                else if (tail_.compare_exchange_weak(pos, pos + claimed, std::memory_order_relaxed))
+                {
+                    return { pos, claimed };
+                }
             }
         }
-        else if (diff < 0)
+    }
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+std::pair<std::size_t, std::size_t>
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::claim_for_dequeue(std::size_t const count) noexcept
+{
+    std::size_t pos = head_.load(std::memory_order_relaxed);
+
+    if constexpr (!sequenced)
+    {
+        // SPSC: the consumer owns head_, only look at the producer's index when the cached
+        // copy says there are not enough items
+        std::size_t available = cached_tail_ - pos;
+        if (available < count)
         {
-            // Queue is full
-            return false;
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            available = cached_tail_ - pos;
         }
-        else
+        return { pos, std::min(count, available) };
+    }
+    else
+    {
+        for (;;)
         {
-            // Another thread claimed the cell, get updated position
-            pos = tail_.load(std::memory_order_relaxed);
+            // Count the published cells following the current position
+            std::size_t claimed = 0;
+            intptr_t diff = 0;
+            while (claimed < count)
+            {
+                std::size_t seq = load_sequence(pos + claimed);
+                diff = (intptr_t)seq - (intptr_t)(pos + claimed + 1);
+                if (diff != 0)
+                {
+                    break;
+                }
+                ++claimed;
+            }
+
+            if (claimed == 0 && diff < 0)
+            {
+                // Queue is empty
+                return { pos, 0 };
+            }
+
+            if constexpr (!multi_consumer)
+            {
+                head_.store(pos + claimed, std::memory_order_relaxed);
+                return { pos, claimed };
+            }
+            else
+            {
+                if (claimed == 0)
+                {
+                    // Another thread claimed the cell, get updated position
+                    pos = head_.load(std::memory_order_relaxed);
+                }
+                else if (head_.compare_exchange_weak(pos, pos + claimed, std::memory_order_relaxed))
+                {
+                    return { pos, claimed };
+                }
+            }
         }
     }
 }
 
-template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler>
-bool
-Queue<T, Capacity, Scheduler>::enqueue(T const & item)
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+template <bool Tracked, typename Writer>
+std::size_t
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::do_enqueue(std::size_t const count, Writer && writer)
 {
-    std::size_t pos = tail_.load(std::memory_order_relaxed);
+    auto const [pos, claimed] = claim_for_enqueue(count);
+    if (claimed == 0)
+    {
+        return 0;
+    }
 
-    for (;;)
+    if constexpr (Tracked)
     {
-        // Get the cell at the current position
-        Cell * cell = &buffer_[pos & (Capacity - 1)];
-        std::size_t seq = cell->sequence.load(std::memory_order_acquire);
-        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        // Count the items before a consumer can see them, so their task_done() always finds them
+        unfinished_.fetch_add(static_cast<std::int64_t>(claimed), std::memory_order_relaxed);
+    }
 
-        if (diff == 0)
+    for (std::size_t i = 0; i < claimed; ++i)
+    {
+        // Construct the item in the cell's storage
+        writer(i, storage_at(pos + i));
+        if constexpr (sequenced)
         {
-            // Cell is available, try to claim it
-            if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            // Make the data available to consumers
+            store_sequence(pos + i, pos + i + 1);
+        }
+    }
+    if constexpr (!sequenced)
+    {
+        tail_.store(pos + claimed, std::memory_order_release);
+    }
+
+    if constexpr (Tracked)
+    {
+        // Wake up to one suspended consumer per published item
+        for (std::size_t i = 0; i < claimed; ++i)
+        {
+            if (!consumers_.notify_one())
             {
-                // Store the data
-                cell->data = item;
-                // Make the data available to consumers
-                cell->sequence.store(pos + 1, std::memory_order_release);
-                unfinished_.fetch_add(1, std::memory_order_release);
-                return true;
+                break;
             }
         }
-        else if (diff < 0)
+    }
+    return claimed;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+template <bool Tracked, typename Reader>
+std::size_t
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::do_dequeue(std::size_t const count, Reader && reader)
+{
+    auto const [pos, claimed] = claim_for_dequeue(count);
+    if (claimed == 0)
+    {
+        return 0;
+    }
+
+    // Every claimed cell is released even if `reader` throws; the items it did not get to are dropped
+    std::size_t next = 0;
+    auto release = make_scope_exit([this, pos, claimed, &next]() noexcept {
+        for (; next < claimed; ++next)
+        {
+            release_cell(pos + next);
+        }
+        if constexpr (!sequenced)
         {
-            // Queue is full
-            return false;
+            head_.store(pos + claimed, std::memory_order_release);
         }
-        else
+
+        if constexpr (Tracked)
         {
-            // Another thread claimed the cell, get updated position
-            pos = tail_.load(std::memory_order_relaxed);
+            // Wake up to one suspended producer per freed cell
+            for (std::size_t i = 0; i < claimed; ++i)
+            {
+                if (!producers_.notify_one())
+                {
+                    break;
+                }
+            }
         }
+    });
+
+    for (; next < claimed; ++next)
+    {
+        // Hand the item to the reader in place
+        reader(next, *item_at(pos + next));
+        release_cell(pos + next);
+    }
+    return claimed;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+void
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::release_cell(std::size_t const pos) noexcept
+{
+    std::destroy_at(item_at(pos));
+    if constexpr (sequenced)
+    {
+        // Mark the cell as empty
+        store_sequence(pos, pos + capacity());
+    }
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+T *
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::storage_at(std::size_t const pos) noexcept
+{
+    return reinterpret_cast<T *>(cell_at(pos).storage);
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+T *
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::item_at(std::size_t const pos) noexcept
+{
+    return std::launder(storage_at(pos));
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+template <typename... Args>
+bool
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::try_emplace(Args &&... args)
+{
+    if constexpr (std::is_nothrow_constructible_v<T, Args &&...>)
+    {
+        return do_enqueue(1, [&](std::size_t, T * slot) noexcept { std::construct_at(slot, std::forward<Args>(args)...); }) == 1;
+    }
+    else
+    {
+        // A claimed cell cannot be handed back, so a constructor that may throw runs before claiming
+        static_assert(std::is_nothrow_move_constructible_v<T>, "try_emplace requires a non-throwing constructor from the arguments or a non-throwing move constructor");
+        T item(std::forward<Args>(args)...);
+        return do_enqueue(1, [&item](std::size_t, T * slot) noexcept { std::construct_at(slot, std::move(item)); }) == 1;
     }
 }
 
-template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler>
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+template <typename F>
+bool
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::try_consume(F && consumer)
+{
+    return do_dequeue(1, [&consumer](std::size_t, T & item) { std::invoke(consumer, item); }) == 1;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+bool
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::enqueue(T && item)
+{
+    return try_emplace(std::move(item));
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+bool
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::enqueue(T const & item)
+{
+    return try_emplace(item);
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
 std::optional<T>
-Queue<T, Capacity, Scheduler>::dequeue()
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::dequeue()
+{
+    std::optional<T> result;
+    try_consume([&result](T & item) { result.emplace(std::move(item)); });
+    return result;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+std::size_t
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::enqueue_bulk(std::span<T> items)
+{
+    static_assert(std::is_nothrow_move_constructible_v<T>, "enqueue_bulk requires a non-throwing move constructor");
+
+    if (items.empty())
+    {
+        return 0;
+    }
+
+    return do_enqueue(items.size(), [items](std::size_t i, T * slot) noexcept { std::construct_at(slot, std::move(items[i])); });
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+std::size_t
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::dequeue_bulk(std::span<T> items, std::size_t max)
+{
+    std::size_t const limit = std::min(items.size(), max);
+    if (limit == 0)
+    {
+        return 0;
+    }
+
+    return do_dequeue(limit, [items](std::size_t i, T & item) { items[i] = std::move(item); });
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+bool
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::can_enqueue() const noexcept
+{
+    std::size_t pos = tail_.load(std::memory_order_relaxed);
+
+    if constexpr (!sequenced)
+    {
+        return pos - head_.load(std::memory_order_acquire) < capacity();
+    }
+    else
+    {
+        std::size_t seq = load_sequence(pos);
+
+        // A stale `pos` shows up as a positive difference, which is also worth a retry
+        return (intptr_t)seq - (intptr_t)pos >= 0;
+    }
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+bool
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::can_dequeue() const noexcept
 {
     std::size_t pos = head_.load(std::memory_order_relaxed);
 
-    for (;;)
+    if constexpr (!sequenced)
     {
-        // Get the cell at the current position
-        Cell * cell = &buffer_[pos & (Capacity - 1)];
-        std::size_t seq = cell->sequence.load(std::memory_order_acquire);
-        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+        return tail_.load(std::memory_order_acquire) != pos;
+    }
+    else
+    {
+        std::size_t seq = load_sequence(pos);
 
-        if (diff == 0)
+        return (intptr_t)seq - (intptr_t)(pos + 1) >= 0;
+    }
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+auto
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::async_enqueue(T item) -> exec::task<void>
+{
+    while (true)
+    {
+        if (enqueue(std::move(item)))
         {
-            // Cell has data, try to claim it
-            if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
-            {
-                // Extract the data
-                T result = std::move(cell->data);
-                // Mark the cell as empty
-                cell->sequence.store(pos + Capacity, std::memory_order_release);
-                return result;
-            }
+            co_return;
         }
-        else if (diff < 0)
+
+        // Queue is full, park until a consumer frees a cell and retry
+        co_await Awaiter{ scheduler_, producers_, this, &Queue::can_enqueue };
+    }
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+auto
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::async_dequeue() -> exec::task<T>
+{
+    while (true)
+    {
+        auto result = dequeue();
+        if (result)
         {
-            // Queue is empty
-            return std::nullopt;
+            co_return std::move(*result);
         }
-        else
+
+        // Queue is empty, park until a producer publishes an item and retry
+        co_await Awaiter{ scheduler_, consumers_, this, &Queue::can_dequeue };
+    }
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+auto
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::async_enqueue_bulk(std::span<T> items) -> exec::task<void>
+{
+    while (true)
+    {
+        items = items.subspan(enqueue_bulk(items));
+        if (items.empty())
         {
-            // Another thread claimed the cell, get updated position
-            pos = head_.load(std::memory_order_relaxed);
+            co_return;
         }
+
+        // Queue is full, park until a consumer frees a cell and retry
+        co_await Awaiter{ scheduler_, producers_, this, &Queue::can_enqueue };
     }
 }
 
-template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler>
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
 auto
-Queue<T, Capacity, Scheduler>::async_enqueue(T item) -> exec::task<void>
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::async_dequeue_bulk(std::span<T> items, std::size_t max) -> exec::task<std::size_t>
 {
+    if (std::min(items.size(), max) == 0)
+    {
+        co_return 0;
+    }
+
     while (true)
     {
-        if (enqueue(std::move(item)))
+        std::size_t count = dequeue_bulk(items, max);
+        if (count > 0)
         {
-            co_return;
+            co_return count;
         }
 
-        // Queue is full, yield and retry
-        co_await stdexec::schedule(scheduler_);
+        // Queue is empty, park until a producer publishes an item and retry
+        co_await Awaiter{ scheduler_, consumers_, this, &Queue::can_dequeue };
     }
 }
 
-template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler>
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
 auto
-Queue<T, Capacity, Scheduler>::async_dequeue() -> exec::task<T>
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::async_dequeue_batch(std::span<T> items, std::size_t max, std::chrono::steady_clock::duration max_wait)
+    -> exec::task<std::size_t>
 {
+    max = std::min(items.size(), max);
+
+    std::size_t count = co_await async_dequeue_bulk(items, max);
+    if (count == max)
+    {
+        co_return count;
+    }
+
+    // The deadline starts with the first item, an idle queue does not flush empty batches
+    auto const deadline = std::chrono::steady_clock::now() + max_wait;
     while (true)
     {
-        auto result = dequeue();
-        if (result)
+        count += dequeue_bulk(items.subspan(count), max - count);
+        if (count == max || std::chrono::steady_clock::now() >= deadline)
         {
-            co_return std::move(*result);
+            co_return count;
         }
 
-        // Queue is empty, yield and retry
-        co_await stdexec::schedule(scheduler_);
+        // Parked until more items arrive or the deadline passes, whichever comes first
+        co_await details::TimedParkAwaiter<Queue, Scheduler>{ scheduler_, consumers_, this, &Queue::can_dequeue, deadline };
     }
 }
 
-template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler>
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+auto
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::enqueue_sender(T item) -> details::EnqueueSender<Queue, Scheduler, T>
+{
+    return { details::ParkSite<Queue, Scheduler>{ this, &scheduler_, &producers_, &Queue::can_enqueue }, std::move(item) };
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+auto
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::dequeue_sender() -> details::DequeueSender<Queue, Scheduler, T>
+{
+    return details::DequeueSender<Queue, Scheduler, T>{ details::ParkSite<Queue, Scheduler>{ this, &scheduler_, &consumers_, &Queue::can_dequeue } };
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+auto
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::consumer_site() noexcept -> details::ParkSite<Queue, Scheduler>
+{
+    return details::ParkSite<Queue, Scheduler>{ this, &scheduler_, &consumers_, &Queue::can_dequeue };
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
 constexpr auto
-Queue<T, Capacity, Scheduler>::capacity() const noexcept -> std::size_t
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::capacity() const noexcept -> std::size_t
+{
+    return buffer_.size();
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+bool
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::is_finished() const noexcept
 {
-    return Capacity;
+    return unfinished_.load(std::memory_order_acquire) <= 0;
 }
 
-template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler>
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
 auto
-Queue<T, Capacity, Scheduler>::task_done() -> void
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::task_done() -> void
 {
-    if (unfinished_.load(std::memory_order_relaxed) <= 0)
+    std::int64_t unfinished = unfinished_.load(std::memory_order_relaxed);
+    do
     {
-        throw_error(errc::task_done_called_too_many_times);
+        if (unfinished <= 0)
+        {
+            throw_error(errc::task_done_called_too_many_times);
+        }
+    } while (!unfinished_.compare_exchange_weak(unfinished, unfinished - 1, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    if (unfinished == 1)
+    {
+        // Every task is done, release all joiners
+        joiners_.notify_all();
+        unfinished_.notify_all();
     }
+}
 
-    unfinished_.fetch_sub(1, std::memory_order_relaxed);
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+auto
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::mark_done(std::int64_t const count) noexcept -> void
+{
+    std::int64_t const unfinished = unfinished_.fetch_sub(count, std::memory_order_acq_rel);
+    assert(unfinished >= count);
+    if (unfinished == count)
+    {
+        // Every task is done, release all joiners
+        joiners_.notify_all();
+        unfinished_.notify_all();
+    }
 }
 
-template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler>
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
 auto
-Queue<T, Capacity, Scheduler>::join() -> exec::task<void>
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::join() -> exec::task<void>
 {
-    while (unfinished_.load(std::memory_order_relaxed) > 0)
+    while (!is_finished())
     {
-        co_await stdexec::schedule(scheduler_);
+        co_await Awaiter{ scheduler_, joiners_, this, &Queue::is_finished };
     }
+}
 
-    co_return;
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
+auto
+Queue<T, Capacity, Scheduler, CardinalityV, LayoutV>::join_blocking() -> void
+{
+    std::int64_t unfinished = unfinished_.load(std::memory_order_acquire);
+    while (unfinished > 0)
+    {
+        unfinished_.wait(unfinished, std::memory_order_acquire);
+        unfinished = unfinished_.load(std::memory_order_acquire);
+    }
 }
 
 } // namespace abc::async
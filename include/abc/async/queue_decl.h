@@ -6,48 +6,168 @@
 
 #pragma once
 
+#include "abc/byte.h"
+#include "deadline_queue_fwd_decl.h"
 #include "queue_fwd_decl.h"
+#include "sharded_queue_fwd_decl.h"
+
+#include "details/park_awaiter.h"
+#include "details/queue_senders.h"
+#include "details/ring_storage.h"
+#include "details/timed_park_awaiter.h"
+#include "details/waiter_list.h"
 
 #include <exec/task.hpp>
 
-#include <array>
+#include <algorithm>
 #include <atomic>
+#include <bit>
+#include <chrono>
 #include <cstdint>
 #include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
 
 namespace abc::async
 {
 
-template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler>
+// Bounded lock-free queue. `CardinalityV` selects the ring protocol:
+//  - Mpmc: Vyukov's sequence-numbered cells, CAS on both indices (the default)
+//  - Mpsc / Spmc: sequence-numbered cells, CAS only on the shared side's index
+//  - Spsc: wait-free ring of plain cells, each side caches the other side's index
+// Calling a single-producer (consumer) queue from several producers (consumers) is undefined.
+// With `Capacity == std::dynamic_extent` the capacity is given at construction and the cells
+// are heap (page) allocated; see DynamicQueue.
+// `LayoutV` trades memory for less false sharing between neighbouring cells when `T` is small:
+// Padded gives each cell its own cache line(s), Remapped keeps the cells packed but places
+// consecutive positions on different lines.
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV, QueueCellLayout LayoutV>
 class Queue
 {
 private:
-    // Each cell has a sequence number and data
-    struct Cell
+    static constexpr bool multi_producer = CardinalityV == QueueCardinality::Mpmc || CardinalityV == QueueCardinality::Mpsc;
+    static constexpr bool multi_consumer = CardinalityV == QueueCardinality::Mpmc || CardinalityV == QueueCardinality::Spmc;
+    static constexpr bool sequenced = multi_producer || multi_consumer;
+
+    static constexpr std::size_t cache_line_size_in_bytes = 64; // Assuming 64-byte cache line size
+
+    // Each cell has a sequence number and raw storage for one item; items are constructed in
+    // place on enqueue and destroyed on dequeue. The sequence is accessed through std::atomic_ref
+    // and stored relative to the cell's index (see load_sequence()), so zero-filled storage is the
+    // initial state and needs no per-cell initialization.
+    struct SequencedCell
+    {
+        mutable std::size_t sequence;
+        alignas(T) byte_t storage[sizeof(T)];
+    };
+
+    // SPSC cells are ordered by the indices alone
+    struct PlainCell
+    {
+        alignas(T) byte_t storage[sizeof(T)];
+    };
+
+    // Cell starting on a cache line boundary and padded to whole lines
+    template <typename Base>
+    struct alignas(std::max(cache_line_size_in_bytes, alignof(Base))) CacheLineCell : Base
     {
-        std::atomic<std::size_t> sequence;
-        T data;
     };
 
+    using BaseCell = std::conditional_t<sequenced, SequencedCell, PlainCell>;
+    using Cell = std::conditional_t<LayoutV == QueueCellLayout::Padded, CacheLineCell<BaseCell>, BaseCell>;
+
+    // Cells sharing a cache line in the remapped layout; 1 disables remapping
+    static constexpr std::size_t cells_per_line =
+        LayoutV == QueueCellLayout::Remapped && sizeof(Cell) < cache_line_size_in_bytes ? std::bit_floor(cache_line_size_in_bytes / sizeof(Cell)) : 1;
+
     // Buffer of cells
-    std::array<Cell, Capacity> buffer_;
+    details::RingStorage<Cell, Capacity> buffer_;
 
-    // Padded atomic indices to prevent false sharing
-    static constexpr std::size_t cache_line_size_in_bytes = 64; // Assuming 64-byte cache line size
+    // Padded atomic indices to prevent false sharing. Each index shares its line with the
+    // owner's cached copy of the opposite index, which only the SPSC protocol uses.
     alignas(cache_line_size_in_bytes) std::atomic<std::size_t> head_{ 0 };
+    std::size_t cached_tail_{ 0 };
     alignas(cache_line_size_in_bytes) std::atomic<std::size_t> tail_{ 0 };
+    std::size_t cached_head_{ 0 };
     alignas(cache_line_size_in_bytes) std::atomic<std::int64_t> unfinished_{ 0 };
 
+    // Suspended producers (waiting for a free cell), consumers (waiting for an item) and joiners
+    // (waiting for every item to be done)
+    alignas(cache_line_size_in_bytes) details::WaiterList producers_;
+    alignas(cache_line_size_in_bytes) details::WaiterList consumers_;
+    alignas(cache_line_size_in_bytes) details::WaiterList joiners_;
+
     Scheduler scheduler_;
 
+    // Parks the calling coroutine on one of the waiter lists, resumed through `scheduler_`
+    using Awaiter = details::ParkAwaiter<Queue, Scheduler>;
+
+    static auto validated_capacity(std::size_t capacity) -> std::size_t;
+
+    // Cell for position `pos`. The remapped layout stripes consecutive positions over the cache
+    // lines: with L lines, index q * L + r lives in slot q of line r.
+    auto cell_at(std::size_t pos) noexcept -> Cell &;
+    auto cell_at(std::size_t pos) const noexcept -> Cell const &;
+    auto physical_index(std::size_t index) const noexcept -> std::size_t;
+
+    // Sequence number of the cell for position `pos`; cell i starts out expecting sequence i
+    auto load_sequence(std::size_t pos) const noexcept -> std::size_t;
+    auto store_sequence(std::size_t pos, std::size_t sequence) noexcept -> void;
+
+    // True when the cell at the current tail / head can be claimed, i.e. a retry may succeed
+    auto can_enqueue() const noexcept -> bool;
+    auto can_dequeue() const noexcept -> bool;
+
+    // True when no enqueued item is waiting for task_done()
+    auto is_finished() const noexcept -> bool;
+
+    // Reserve up to `count` consecutive cells for writing / reading. Return the first sequence
+    // number and the number of cells actually reserved.
+    auto claim_for_enqueue(std::size_t count) noexcept -> std::pair<std::size_t, std::size_t>;
+    auto claim_for_dequeue(std::size_t count) noexcept -> std::pair<std::size_t, std::size_t>;
+
+    // Claim, fill / drain through `writer(i, slot)` / `reader(i, item)`, publish and wake
+    // waiters on the other side. Return the number of items transferred. Writers construct the
+    // item in the uninitialized `slot` and must not throw, a claimed cell cannot be handed back.
+    // Untracked operations neither count items for task_done() nor wake anybody, for owners
+    // that do both themselves (the shards of a ShardedQueue).
+    template <bool Tracked = true, typename Writer>
+    auto do_enqueue(std::size_t count, Writer && writer) -> std::size_t;
+
+    template <bool Tracked = true, typename Reader>
+    auto do_dequeue(std::size_t count, Reader && reader) -> std::size_t;
+
+    // Destroys the item at `pos` and hands the cell back to producers
+    auto release_cell(std::size_t pos) noexcept -> void;
+
+    auto storage_at(std::size_t pos) noexcept -> T *;
+    auto item_at(std::size_t pos) noexcept -> T *;
+
+    // task_done() for `count` items the queue knows were never delivered (dropped by a
+    // DeadlineQueue), so it cannot over-call and does not throw
+    auto mark_done(std::int64_t count) noexcept -> void;
+
+    template <typename, std::size_t, stdexec::scheduler>
+    friend class ShardedQueue;
+
+    template <typename, std::size_t, stdexec::scheduler, OverloadPolicy, QueueCardinality, typename>
+    friend class DeadlineQueue;
+
 public:
-    explicit Queue(Scheduler scheduler);
+    explicit Queue(Scheduler scheduler)
+        requires(Capacity != std::dynamic_extent);
+
+    // Throws abc_error(errc::invalid_queue_capacity) unless `capacity` is a power of 2
+    Queue(Scheduler scheduler, std::size_t capacity)
+        requires(Capacity == std::dynamic_extent);
 
     // Non-copyable, non-movable
     Queue(Queue const &) = delete;
     auto operator=(Queue const &) -> Queue & = delete;
     Queue(Queue &&) = delete;
     auto operator=(Queue &&) -> Queue & = delete;
+    ~Queue();
 
     // Async enqueue operation
     auto async_enqueue(T item) -> exec::task<void>;
@@ -55,11 +175,51 @@ public:
     // Async dequeue operation
     auto async_dequeue() -> exec::task<T>;
 
+    // Sender versions of async_enqueue / async_dequeue. The operation state lives wherever the
+    // sender is connected (e.g. the awaiting coroutine's frame) and an operation that can
+    // complete immediately does so inside start(): no allocation and no scheduler hop. Only
+    // an operation that has to wait is resumed through the scheduler.
+    auto enqueue_sender(T item) -> details::EnqueueSender<Queue, Scheduler, T>;
+    auto dequeue_sender() -> details::DequeueSender<Queue, Scheduler, T>;
+
+    // Where consumers wait while the queue is empty, for operations waiting on several queues at
+    // once (see async_select)
+    auto consumer_site() noexcept -> details::ParkSite<Queue, Scheduler>;
+
+    // Constructs the item directly in a free cell. Returns false, without constructing, when full.
+    // T must be nothrow constructible from `args`, or nothrow move constructible: then the item
+    // is built before a cell is claimed, and moved in.
+    template <typename... Args>
+    auto try_emplace(Args &&... args) -> bool;
+
+    // Invokes `consumer(T &)` on the oldest item in place, then destroys it. Returns false when
+    // empty. The item counts as dequeued even if `consumer` throws.
+    template <typename F>
+    auto try_consume(F && consumer) -> bool;
+
     // Synchronous operations for convenience
     auto enqueue(T && item) -> bool;
     auto enqueue(T const & item) -> bool;
     auto dequeue() -> std::optional<T>;
 
+    // Bulk operations. A contiguous run of cells is reserved with a single CAS on the index
+    // (a plain store on a single-owner side), then filled / drained. Both return the number of items transferred, which may be less
+    // than requested (0 when the queue is full / empty). Enqueued items are moved from.
+    auto enqueue_bulk(std::span<T> items) -> std::size_t;
+    auto dequeue_bulk(std::span<T> items, std::size_t max) -> std::size_t;
+
+    // Async bulk operations. `async_enqueue_bulk` completes once every item has been enqueued;
+    // `async_dequeue_bulk` completes as soon as at least one item has been dequeued.
+    auto async_enqueue_bulk(std::span<T> items) -> exec::task<void>;
+    auto async_dequeue_bulk(std::span<T> items, std::size_t max) -> exec::task<std::size_t>;
+
+    // Coalescing dequeue into `items`: completes once `max` items (capped by the buffer size) have
+    // been dequeued, or `max_wait` after the first item arrived, whichever comes first. Returns
+    // the number of items dequeued, at least one unless `max` or the buffer is empty. Waiting for
+    // the first item parks, and so does the `max_wait` window, with a timer on the default
+    // TimerService bounding it; consumers trade that bounded latency for fuller batches.
+    auto async_dequeue_batch(std::span<T> items, std::size_t max, std::chrono::steady_clock::duration max_wait) -> exec::task<std::size_t>;
+
     // Query operations
     auto empty() const noexcept -> bool;
     auto full() const noexcept -> bool;
@@ -67,8 +227,15 @@ public:
 
     constexpr auto capacity() const noexcept -> std::size_t;
 
+    // Marks one dequeued item as processed. Throws abc_error(errc::task_done_called_too_many_times)
+    // if there is no unfinished item. The call bringing the count to zero resumes every joiner.
     auto task_done() -> void;
+
+    // Completes once every enqueued item has been marked done. Joiners are parked, not polled.
     auto join() -> exec::task<void>;
+
+    // join() for threads outside any coroutine; blocks the calling thread.
+    auto join_blocking() -> void;
 };
 
 } // namespace abc::async
@@ -8,12 +8,51 @@
 
 #include <stdexec/execution.hpp>
 
+#include <span>
+
 namespace abc::async
 {
 
-template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler>
+// Number of threads allowed on each side of a queue
+enum class QueueCardinality
+{
+    Mpmc,
+    Mpsc,
+    Spmc,
+    Spsc
+};
+
+// Arrangement of a queue's cells in memory
+enum class QueueCellLayout
+{
+    Packed,   // cells back to back, the most compact
+    Padded,   // every cell on its own cache line(s)
+    Remapped, // cells packed, but consecutive positions map to different cache lines
+};
+
+template <typename T,
+          std::size_t Capacity,
+          stdexec::scheduler Scheduler,
+          QueueCardinality CardinalityV = QueueCardinality::Mpmc,
+          QueueCellLayout LayoutV = QueueCellLayout::Packed>
 class Queue;
 
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCellLayout LayoutV = QueueCellLayout::Packed>
+using MpscQueue = Queue<T, Capacity, Scheduler, QueueCardinality::Mpsc, LayoutV>;
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCellLayout LayoutV = QueueCellLayout::Packed>
+using SpmcQueue = Queue<T, Capacity, Scheduler, QueueCardinality::Spmc, LayoutV>;
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCellLayout LayoutV = QueueCellLayout::Packed>
+using SpscQueue = Queue<T, Capacity, Scheduler, QueueCardinality::Spsc, LayoutV>;
+
+// Queue whose capacity is chosen at construction
+template <typename T,
+          stdexec::scheduler Scheduler,
+          QueueCardinality CardinalityV = QueueCardinality::Mpmc,
+          QueueCellLayout LayoutV = QueueCellLayout::Packed>
+using DynamicQueue = Queue<T, std::dynamic_extent, Scheduler, CardinalityV, LayoutV>;
+
 }
 
 #endif // ABC_INCLUDE_ABC_ASYNC_QUEUE_FWD_DECL
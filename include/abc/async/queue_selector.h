@@ -0,0 +1,119 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_QUEUE_SELECTOR
+#define ABC_INCLUDE_ABC_ASYNC_QUEUE_SELECTOR
+
+#pragma once
+
+#include "queue.h"
+#include "queue_selector_decl.h"
+
+namespace abc::async
+{
+
+template <SelectOrder OrderV, typename... Queues>
+QueueSelector<OrderV, Queues...>::QueueSelector(Queues &... queues) noexcept : queues_{ queues... }
+{
+}
+
+template <SelectOrder OrderV, typename... Queues>
+template <std::size_t I>
+bool
+QueueSelector<OrderV, Queues...>::try_dequeue_from(std::optional<result_type> & result)
+{
+    if (auto item = std::get<I>(queues_).dequeue())
+    {
+        result.emplace(std::in_place_index<I>, std::move(*item));
+        return true;
+    }
+    return false;
+}
+
+template <SelectOrder OrderV, typename... Queues>
+bool
+QueueSelector<OrderV, Queues...>::try_dequeue_at(std::size_t const index, std::optional<result_type> & result)
+{
+    return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        return ((index == Is && try_dequeue_from<Is>(result)) || ...);
+    }(std::index_sequence_for<Queues...>{});
+}
+
+template <SelectOrder OrderV, typename... Queues>
+void
+QueueSelector<OrderV, Queues...>::notify_at(std::size_t const index)
+{
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        ((index == Is && std::get<Is>(queues_).consumer_site().list->notify_one()) || ...);
+    }(std::index_sequence_for<Queues...>{});
+}
+
+template <SelectOrder OrderV, typename... Queues>
+auto
+QueueSelector<OrderV, Queues...>::park() -> Awaiter
+{
+    return std::apply(
+        [](Queues &... queues) { return Awaiter{ *std::get<0>(std::tie(queues...)).consumer_site().scheduler, queues.consumer_site()... }; },
+        queues_);
+}
+
+template <SelectOrder OrderV, typename... Queues>
+auto
+QueueSelector<OrderV, Queues...>::try_select() -> std::optional<result_type>
+{
+    std::optional<result_type> result;
+    std::size_t const first = OrderV == SelectOrder::RoundRobin ? next_ : 0;
+    for (std::size_t i = 0; i != queue_count; ++i)
+    {
+        std::size_t const index = (first + i) % queue_count;
+        if (try_dequeue_at(index, result))
+        {
+            next_ = (index + 1) % queue_count;
+            break;
+        }
+    }
+    return result;
+}
+
+template <SelectOrder OrderV, typename... Queues>
+auto
+QueueSelector<OrderV, Queues...>::async_select() -> exec::task<result_type>
+{
+    while (true)
+    {
+        if (auto result = try_select())
+        {
+            co_return std::move(*result);
+        }
+
+        std::size_t const woken = co_await park();
+        if (auto result = try_select())
+        {
+            // The item this selector was woken for is still there, wake another consumer for it
+            if (woken != result->index() && woken < queue_count)
+            {
+                notify_at(woken);
+            }
+            co_return std::move(*result);
+        }
+    }
+}
+
+template <typename... Queues>
+auto
+try_select(Queues &... queues) -> std::optional<typename QueueSelector<SelectOrder::Priority, Queues...>::result_type>
+{
+    return QueueSelector<SelectOrder::Priority, Queues...>{ queues... }.try_select();
+}
+
+template <typename... Queues>
+auto
+async_select(Queues &... queues) -> exec::task<typename QueueSelector<SelectOrder::Priority, Queues...>::result_type>
+{
+    QueueSelector<SelectOrder::Priority, Queues...> selector{ queues... };
+    co_return co_await selector.async_select();
+}
+
+} // namespace abc::async
+
+#endif // ABC_INCLUDE_ABC_ASYNC_QUEUE_SELECTOR
@@ -0,0 +1,88 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_QUEUE_SELECTOR_DECL
+#define ABC_INCLUDE_ABC_ASYNC_QUEUE_SELECTOR_DECL
+
+#pragma once
+
+#include "queue_decl.h"
+#include "queue_selector_fwd_decl.h"
+
+#include "details/select_awaiter.h"
+
+#include <exec/task.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace abc::async
+{
+
+namespace details
+{
+
+template <typename Queue>
+using queue_value_t = typename decltype(std::declval<Queue &>().dequeue())::value_type;
+
+}
+
+// Consumer side over several `Queue`s (e.g. a control and a data queue), dequeueing from whichever
+// has an item. When all are empty, async_select() suspends once, parked on every queue, and is
+// resumed through the first queue's scheduler by whichever queue receives an item first.
+//
+// The result is a variant whose alternative index is the index of the queue the item came from.
+// A selector keeps the round-robin position, so each consumer uses its own selector.
+template <SelectOrder OrderV, typename... Queues>
+class QueueSelector
+{
+public:
+    using result_type = std::variant<details::queue_value_t<Queues>...>;
+
+private:
+    static_assert(sizeof...(Queues) != 0, "QueueSelector needs at least one queue");
+
+    static constexpr std::size_t queue_count = sizeof...(Queues);
+
+    using FirstQueue = std::tuple_element_t<0, std::tuple<Queues...>>;
+    using Scheduler = std::remove_pointer_t<decltype(std::declval<FirstQueue &>().consumer_site().scheduler)>;
+    using Awaiter = details::SelectAwaiter<Scheduler, decltype(std::declval<Queues &>().consumer_site())...>;
+
+    std::tuple<Queues &...> queues_;
+
+    // Queue tried first by the next selection (RoundRobin only)
+    std::size_t next_{ 0 };
+
+    template <std::size_t I>
+    auto try_dequeue_from(std::optional<result_type> & result) -> bool;
+
+    // Runtime-indexed try_dequeue_from() / wakeup hand-over
+    auto try_dequeue_at(std::size_t index, std::optional<result_type> & result) -> bool;
+    auto notify_at(std::size_t index) -> void;
+
+    auto park() -> Awaiter;
+
+public:
+    explicit QueueSelector(Queues &... queues) noexcept;
+
+    // Dequeues from the first queue (in OrderV) that has an item, std::nullopt when all are empty
+    auto try_select() -> std::optional<result_type>;
+
+    // try_select() waiting (parked on every queue) while all queues are empty
+    auto async_select() -> exec::task<result_type>;
+};
+
+// One-off selections in priority (argument) order: the first queue is always drained first
+template <typename... Queues>
+auto try_select(Queues &... queues) -> std::optional<typename QueueSelector<SelectOrder::Priority, Queues...>::result_type>;
+
+template <typename... Queues>
+auto async_select(Queues &... queues) -> exec::task<typename QueueSelector<SelectOrder::Priority, Queues...>::result_type>;
+
+} // namespace abc::async
+
+#endif // ABC_INCLUDE_ABC_ASYNC_QUEUE_SELECTOR_DECL
@@ -0,0 +1,24 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_QUEUE_SELECTOR_FWD_DECL
+#define ABC_INCLUDE_ABC_ASYNC_QUEUE_SELECTOR_FWD_DECL
+
+#pragma once
+
+namespace abc::async
+{
+
+// Which queue a QueueSelector tries first when several have items
+enum class SelectOrder
+{
+    Priority,   // always in argument order, earlier queues are drained first
+    RoundRobin, // starting after the queue the previous item came from
+};
+
+template <SelectOrder OrderV, typename... Queues>
+class QueueSelector;
+
+}
+
+#endif // ABC_INCLUDE_ABC_ASYNC_QUEUE_SELECTOR_FWD_DECL
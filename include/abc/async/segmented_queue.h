@@ -0,0 +1,458 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_SEGMENTED_QUEUE
+#define ABC_INCLUDE_ABC_ASYNC_SEGMENTED_QUEUE
+
+#pragma once
+
+#include "segmented_queue_decl.h"
+
+#include "abc/error.h"
+#include "abc/scope_guard.h"
+
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace abc::async
+{
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+SegmentedQueue<T, SegmentCapacity, Scheduler>::SegmentedQueue(Scheduler scheduler, std::size_t const soft_limit)
+    : soft_limit_{ soft_limit }, scheduler_{ scheduler }
+{
+    static_assert(SegmentCapacity > 0, "Segment capacity must be greater than 0");
+    static_assert((SegmentCapacity & (SegmentCapacity - 1)) == 0, "Segment capacity must be a power of 2");
+
+    std::lock_guard<std::mutex> lock{ segments_mutex_ };
+    Segment * segment = acquire_segment(0);
+    head_segment_.store(segment, std::memory_order_relaxed);
+    tail_segment_.store(segment, std::memory_order_relaxed);
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+SegmentedQueue<T, SegmentCapacity, Scheduler>::~SegmentedQueue()
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        // Destroy the items nobody dequeued
+        std::size_t const tail = tail_.load(std::memory_order_acquire);
+        Segment * segment = head_segment_.load(std::memory_order_acquire);
+        for (std::size_t pos = head_.load(std::memory_order_acquire); pos != tail; ++pos)
+        {
+            while (segment->base.load(std::memory_order_relaxed) != segment_base(pos))
+            {
+                segment = segment->next.load(std::memory_order_relaxed);
+            }
+            std::destroy_at(std::launder(reinterpret_cast<T *>(segment->cells[pos & (SegmentCapacity - 1)].storage)));
+        }
+    }
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+constexpr std::size_t
+SegmentedQueue<T, SegmentCapacity, Scheduler>::segment_base(std::size_t const pos) noexcept
+{
+    return pos & ~(SegmentCapacity - 1);
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+typename SegmentedQueue<T, SegmentCapacity, Scheduler>::Segment *
+SegmentedQueue<T, SegmentCapacity, Scheduler>::acquire_segment(std::size_t const base)
+{
+    Segment * segment = free_segments_;
+    if (segment != nullptr)
+    {
+        free_segments_ = segment->next_free;
+    }
+    else
+    {
+        segments_.push_back(std::make_unique<Segment>());
+        segment = segments_.back().get();
+    }
+
+    segment->next.store(nullptr, std::memory_order_relaxed);
+    segment->consumed.store(0, std::memory_order_relaxed);
+    segment->drained = false;
+    segment->next_free = nullptr;
+    for (std::size_t i = 0; i < SegmentCapacity; ++i)
+    {
+        segment->cells[i].sequence.store(base + i, std::memory_order_relaxed);
+    }
+
+    // Published to other threads through the release store linking the segment
+    segment->base.store(base, std::memory_order_relaxed);
+    return segment;
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+typename SegmentedQueue<T, SegmentCapacity, Scheduler>::Segment *
+SegmentedQueue<T, SegmentCapacity, Scheduler>::segment_for_enqueue(std::size_t const pos)
+{
+    Segment * segment = tail_segment_.load(std::memory_order_acquire);
+    std::size_t const base = segment_base(pos);
+    std::size_t const current = segment->base.load(std::memory_order_relaxed);
+    if (current == base)
+    {
+        return segment;
+    }
+
+    // Only the first position past the tail segment needs a new one, anything else is stale
+    if (current + SegmentCapacity == base)
+    {
+        // The segment may have been recycled and come back as the tail with a newer base while
+        // this producer waited, only link when the tail still is what was read above
+        std::lock_guard<std::mutex> lock{ segments_mutex_ };
+        if (tail_segment_.load(std::memory_order_relaxed) == segment && segment->base.load(std::memory_order_relaxed) == current)
+        {
+            Segment * next = acquire_segment(base);
+            segment->next.store(next, std::memory_order_release);
+            tail_segment_.store(next, std::memory_order_release);
+
+            // A segment drained before its successor was linked can go now
+            recycle_drained_segments();
+        }
+    }
+    return nullptr;
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+typename SegmentedQueue<T, SegmentCapacity, Scheduler>::Segment *
+SegmentedQueue<T, SegmentCapacity, Scheduler>::segment_for_dequeue(std::size_t const pos) const noexcept
+{
+    std::size_t const base = segment_base(pos);
+    Segment * segment = head_segment_.load(std::memory_order_acquire);
+    while (segment != nullptr)
+    {
+        std::size_t const current = segment->base.load(std::memory_order_relaxed);
+        if (current == base)
+        {
+            return segment;
+        }
+        if (current > base)
+        {
+            return nullptr;
+        }
+        segment = segment->next.load(std::memory_order_acquire);
+    }
+    return nullptr;
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+void
+SegmentedQueue<T, SegmentCapacity, Scheduler>::retire_segment(Segment * segment)
+{
+    std::lock_guard<std::mutex> lock{ segments_mutex_ };
+    segment->drained = true;
+    recycle_drained_segments();
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+void
+SegmentedQueue<T, SegmentCapacity, Scheduler>::recycle_drained_segments() noexcept
+{
+    // Segments drain in any order but leave the chain in FIFO order. The tail segment stays
+    // until its successor is linked.
+    Segment * segment = head_segment_.load(std::memory_order_relaxed);
+    while (segment->drained)
+    {
+        Segment * next = segment->next.load(std::memory_order_relaxed);
+        if (next == nullptr)
+        {
+            break;
+        }
+
+        head_segment_.store(next, std::memory_order_release);
+        segment->next_free = free_segments_;
+        free_segments_ = segment;
+        segment = next;
+    }
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+bool
+SegmentedQueue<T, SegmentCapacity, Scheduler>::can_enqueue() const noexcept
+{
+    return size() < soft_limit_;
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+bool
+SegmentedQueue<T, SegmentCapacity, Scheduler>::can_dequeue() const noexcept
+{
+    return !empty();
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+template <typename Writer>
+bool
+SegmentedQueue<T, SegmentCapacity, Scheduler>::do_enqueue(Writer && writer)
+{
+    if (!can_enqueue())
+    {
+        return false;
+    }
+
+    Cell * cell = nullptr;
+    std::size_t pos = tail_.load(std::memory_order_relaxed);
+    while (true)
+    {
+        Segment * segment = segment_for_enqueue(pos);
+        if (segment != nullptr)
+        {
+            cell = &segment->cells[pos & (SegmentCapacity - 1)];
+            if (cell->sequence.load(std::memory_order_acquire) == pos)
+            {
+                // Try to claim the cell
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+                continue;
+            }
+        }
+        pos = tail_.load(std::memory_order_relaxed);
+    }
+
+    writer(reinterpret_cast<T *>(cell->storage));
+
+    // Count the item before a consumer can see it, so its task_done() always finds it
+    unfinished_.fetch_add(1, std::memory_order_relaxed);
+
+    // Make the data available to consumers
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    consumers_.notify_one();
+    return true;
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+template <typename Reader>
+bool
+SegmentedQueue<T, SegmentCapacity, Scheduler>::do_dequeue(Reader && reader)
+{
+    Segment * segment = nullptr;
+    Cell * cell = nullptr;
+    std::size_t pos = head_.load(std::memory_order_relaxed);
+    while (true)
+    {
+        segment = segment_for_dequeue(pos);
+        if (segment != nullptr)
+        {
+            cell = &segment->cells[pos & (SegmentCapacity - 1)];
+            if (cell->sequence.load(std::memory_order_acquire) == pos + 1)
+            {
+                // Try to claim the item
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+                continue;
+            }
+        }
+
+        std::size_t const head = head_.load(std::memory_order_relaxed);
+        if (head == pos && (segment != nullptr || tail_.load(std::memory_order_acquire) == pos))
+        {
+            // Nothing published at the head
+            return false;
+        }
+        pos = head;
+    }
+
+    // The cell is released even if `reader` throws
+    T * item = std::launder(reinterpret_cast<T *>(cell->storage));
+    auto release = make_scope_exit([this, segment, item]() noexcept {
+        std::destroy_at(item);
+        if (segment->consumed.fetch_add(1, std::memory_order_acq_rel) + 1 == SegmentCapacity)
+        {
+            retire_segment(segment);
+        }
+        producers_.notify_one();
+    });
+
+    reader(*item);
+    return true;
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+template <typename... Args>
+bool
+SegmentedQueue<T, SegmentCapacity, Scheduler>::try_emplace(Args &&... args)
+{
+    if constexpr (std::is_nothrow_constructible_v<T, Args &&...>)
+    {
+        return do_enqueue([&](T * slot) noexcept { std::construct_at(slot, std::forward<Args>(args)...); });
+    }
+    else
+    {
+        // A claimed cell cannot be handed back, so a constructor that may throw runs before claiming
+        static_assert(std::is_nothrow_move_constructible_v<T>, "try_emplace requires a non-throwing constructor from the arguments or a non-throwing move constructor");
+        T item(std::forward<Args>(args)...);
+        return do_enqueue([&item](T * slot) noexcept { std::construct_at(slot, std::move(item)); });
+    }
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+template <typename F>
+bool
+SegmentedQueue<T, SegmentCapacity, Scheduler>::try_consume(F && consumer)
+{
+    return do_dequeue([&consumer](T & item) { std::invoke(consumer, item); });
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+bool
+SegmentedQueue<T, SegmentCapacity, Scheduler>::enqueue(T && item)
+{
+    return try_emplace(std::move(item));
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+bool
+SegmentedQueue<T, SegmentCapacity, Scheduler>::enqueue(T const & item)
+{
+    return try_emplace(item);
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+std::optional<T>
+SegmentedQueue<T, SegmentCapacity, Scheduler>::dequeue()
+{
+    std::optional<T> result;
+    try_consume([&result](T & item) { result.emplace(std::move(item)); });
+    return result;
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+auto
+SegmentedQueue<T, SegmentCapacity, Scheduler>::async_enqueue(T item) -> exec::task<void>
+{
+    while (true)
+    {
+        if (enqueue(std::move(item)))
+        {
+            co_return;
+        }
+
+        // Soft limit reached, park until a consumer takes an item and retry
+        co_await Awaiter{ scheduler_, producers_, this, &SegmentedQueue::can_enqueue };
+    }
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+auto
+SegmentedQueue<T, SegmentCapacity, Scheduler>::async_dequeue() -> exec::task<T>
+{
+    while (true)
+    {
+        auto result = dequeue();
+        if (result)
+        {
+            co_return std::move(*result);
+        }
+
+        // Queue is empty, park until a producer publishes an item and retry
+        co_await Awaiter{ scheduler_, consumers_, this, &SegmentedQueue::can_dequeue };
+    }
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+auto
+SegmentedQueue<T, SegmentCapacity, Scheduler>::enqueue_sender(T item) -> details::EnqueueSender<SegmentedQueue, Scheduler, T>
+{
+    return { details::ParkSite<SegmentedQueue, Scheduler>{ this, &scheduler_, &producers_, &SegmentedQueue::can_enqueue }, std::move(item) };
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+auto
+SegmentedQueue<T, SegmentCapacity, Scheduler>::dequeue_sender() -> details::DequeueSender<SegmentedQueue, Scheduler, T>
+{
+    return details::DequeueSender<SegmentedQueue, Scheduler, T>{ details::ParkSite<SegmentedQueue, Scheduler>{ this, &scheduler_, &consumers_, &SegmentedQueue::can_dequeue } };
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+bool
+SegmentedQueue<T, SegmentCapacity, Scheduler>::empty() const noexcept
+{
+    return size() == 0;
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+std::size_t
+SegmentedQueue<T, SegmentCapacity, Scheduler>::size() const noexcept
+{
+    // The head never passes the tail, so loading it first keeps the difference non-negative
+    std::size_t const head = head_.load(std::memory_order_acquire);
+    return tail_.load(std::memory_order_acquire) - head;
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+std::size_t
+SegmentedQueue<T, SegmentCapacity, Scheduler>::soft_limit() const noexcept
+{
+    return soft_limit_;
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+std::size_t
+SegmentedQueue<T, SegmentCapacity, Scheduler>::segment_count()
+{
+    std::lock_guard<std::mutex> lock{ segments_mutex_ };
+    return segments_.size();
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+bool
+SegmentedQueue<T, SegmentCapacity, Scheduler>::is_finished() const noexcept
+{
+    return unfinished_.load(std::memory_order_acquire) <= 0;
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+auto
+SegmentedQueue<T, SegmentCapacity, Scheduler>::task_done() -> void
+{
+    std::int64_t unfinished = unfinished_.load(std::memory_order_relaxed);
+    do
+    {
+        if (unfinished <= 0)
+        {
+            throw_error(errc::task_done_called_too_many_times);
+        }
+    } while (!unfinished_.compare_exchange_weak(unfinished, unfinished - 1, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    if (unfinished == 1)
+    {
+        // Every task is done, release all joiners
+        joiners_.notify_all();
+        unfinished_.notify_all();
+    }
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+auto
+SegmentedQueue<T, SegmentCapacity, Scheduler>::join() -> exec::task<void>
+{
+    while (!is_finished())
+    {
+        co_await Awaiter{ scheduler_, joiners_, this, &SegmentedQueue::is_finished };
+    }
+}
+
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+auto
+SegmentedQueue<T, SegmentCapacity, Scheduler>::join_blocking() -> void
+{
+    std::int64_t unfinished = unfinished_.load(std::memory_order_acquire);
+    while (unfinished > 0)
+    {
+        unfinished_.wait(unfinished, std::memory_order_acquire);
+        unfinished = unfinished_.load(std::memory_order_acquire);
+    }
+}
+
+} // namespace abc::async
+
+#endif // ABC_INCLUDE_ABC_ASYNC_SEGMENTED_QUEUE
@@ -0,0 +1,195 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_SEGMENTED_QUEUE_DECL
+#define ABC_INCLUDE_ABC_ASYNC_SEGMENTED_QUEUE_DECL
+
+#pragma once
+
+#include "abc/byte.h"
+#include "segmented_queue_fwd_decl.h"
+
+#include "details/park_awaiter.h"
+#include "details/queue_senders.h"
+#include "details/waiter_list.h"
+
+#include <exec/task.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace abc::async
+{
+
+// Unbounded lock-free MPMC queue made of fixed-size ring segments linked in FIFO order.
+//
+// Positions are global 64-bit counters; position p lives in cell `p % SegmentCapacity` of the
+// segment whose base is `p - p % SegmentCapacity`. Cells carry Vyukov sequence numbers in the
+// same global numbering, so an operation that raced with a segment being recycled fails its
+// sequence check or its CAS on the index and simply retries. Linking, retiring and recycling
+// segments takes a mutex, once per `SegmentCapacity` items; a producer links a new tail only
+// if, under that mutex, the tail is still the segment and base it read, since the segment may
+// have been recycled into a newer tail meanwhile.
+//
+// Drained segments go to a free-list and are reused instead of freed, so the memory of the
+// largest burst is kept until the queue is destroyed. An optional soft limit bounds the size:
+// `enqueue` fails and `async_enqueue` waits while `size() >= soft_limit()`. Producers racing at
+// the limit may overshoot it by up to one item each.
+template <typename T, std::size_t SegmentCapacity, stdexec::scheduler Scheduler>
+class SegmentedQueue
+{
+private:
+    static constexpr std::size_t cache_line_size_in_bytes = 64; // Assuming 64-byte cache line size
+
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        alignas(T) byte_t storage[sizeof(T)];
+    };
+
+    struct Segment
+    {
+        // Position of the first cell
+        std::atomic<std::size_t> base{ 0 };
+        std::atomic<Segment *> next{ nullptr };
+
+        // Cells consumed so far; the consumer of the last one retires the segment
+        std::atomic<std::size_t> consumed{ 0 };
+
+        // Guarded by `segments_mutex_`
+        bool drained{ false };
+        Segment * next_free{ nullptr };
+
+        std::array<Cell, SegmentCapacity> cells;
+    };
+
+    // Consumer side
+    alignas(cache_line_size_in_bytes) std::atomic<std::size_t> head_{ 0 };
+    std::atomic<Segment *> head_segment_{ nullptr };
+
+    // Producer side
+    alignas(cache_line_size_in_bytes) std::atomic<std::size_t> tail_{ 0 };
+    std::atomic<Segment *> tail_segment_{ nullptr };
+
+    alignas(cache_line_size_in_bytes) std::atomic<std::int64_t> unfinished_{ 0 };
+
+    // Suspended producers (waiting for the size to drop below the soft limit), consumers
+    // (waiting for an item) and joiners (waiting for every item to be done)
+    alignas(cache_line_size_in_bytes) details::WaiterList producers_;
+    alignas(cache_line_size_in_bytes) details::WaiterList consumers_;
+    alignas(cache_line_size_in_bytes) details::WaiterList joiners_;
+
+    // Every segment ever allocated, linked or free. Segments are only freed by the destructor,
+    // which keeps a racing operation's stale segment pointer dereferenceable.
+    std::mutex segments_mutex_;
+    std::vector<std::unique_ptr<Segment>> segments_;
+    Segment * free_segments_{ nullptr };
+
+    std::size_t soft_limit_;
+    Scheduler scheduler_;
+
+    // Parks the calling coroutine on one of the waiter lists, resumed through `scheduler_`
+    using Awaiter = details::ParkAwaiter<SegmentedQueue, Scheduler>;
+
+    static constexpr auto segment_base(std::size_t pos) noexcept -> std::size_t;
+
+    // Takes a segment off the free-list (or allocates one) and prepares it to hold the
+    // positions from `base`. Requires `segments_mutex_`.
+    auto acquire_segment(std::size_t base) -> Segment *;
+
+    // Segment holding `pos` for a producer, linking a new tail segment when `pos` is the first
+    // position past the current one. nullptr when `pos` is stale and must be reloaded.
+    auto segment_for_enqueue(std::size_t pos) -> Segment *;
+
+    // Segment holding `pos` for a consumer, or nullptr if no such segment is linked (yet).
+    auto segment_for_dequeue(std::size_t pos) const noexcept -> Segment *;
+
+    // Marks `segment` as drained and recycles the drained segments at the front of the chain
+    auto retire_segment(Segment * segment) -> void;
+
+    // Requires `segments_mutex_`
+    auto recycle_drained_segments() noexcept -> void;
+
+    auto can_enqueue() const noexcept -> bool;
+    auto can_dequeue() const noexcept -> bool;
+
+    // True when no enqueued item is waiting for task_done()
+    auto is_finished() const noexcept -> bool;
+
+    // Claim a cell, construct the item through `writer(slot)` / hand it to `reader(item)`,
+    // then wake a waiter on the other side. Writers must not throw.
+    template <typename Writer>
+    auto do_enqueue(Writer && writer) -> bool;
+
+    template <typename Reader>
+    auto do_dequeue(Reader && reader) -> bool;
+
+public:
+    static constexpr std::size_t no_soft_limit = std::numeric_limits<std::size_t>::max();
+
+    explicit SegmentedQueue(Scheduler scheduler, std::size_t soft_limit = no_soft_limit);
+
+    // Non-copyable, non-movable
+    SegmentedQueue(SegmentedQueue const &) = delete;
+    auto operator=(SegmentedQueue const &) -> SegmentedQueue & = delete;
+    SegmentedQueue(SegmentedQueue &&) = delete;
+    auto operator=(SegmentedQueue &&) -> SegmentedQueue & = delete;
+    ~SegmentedQueue();
+
+    // Async enqueue operation; only waits when the soft limit is reached
+    auto async_enqueue(T item) -> exec::task<void>;
+
+    // Async dequeue operation
+    auto async_dequeue() -> exec::task<T>;
+
+    // Sender versions of async_enqueue / async_dequeue. The operation state lives wherever the
+    // sender is connected (e.g. the awaiting coroutine's frame) and an operation that can
+    // complete immediately does so inside start(): no allocation and no scheduler hop. Only
+    // an operation that has to wait is resumed through the scheduler.
+    auto enqueue_sender(T item) -> details::EnqueueSender<SegmentedQueue, Scheduler, T>;
+    auto dequeue_sender() -> details::DequeueSender<SegmentedQueue, Scheduler, T>;
+
+    // Constructs the item directly in a free cell. Returns false, without constructing, at the
+    // soft limit. T must be nothrow constructible from `args`, or nothrow move constructible:
+    // then the item is built before a cell is claimed, and moved in.
+    template <typename... Args>
+    auto try_emplace(Args &&... args) -> bool;
+
+    // Invokes `consumer(T &)` on the oldest item in place, then destroys it. Returns false when
+    // empty. The item counts as dequeued even if `consumer` throws.
+    template <typename F>
+    auto try_consume(F && consumer) -> bool;
+
+    // Synchronous operations. Enqueue returns false only at the soft limit.
+    auto enqueue(T && item) -> bool;
+    auto enqueue(T const & item) -> bool;
+    auto dequeue() -> std::optional<T>;
+
+    // Query operations
+    auto empty() const noexcept -> bool;
+    auto size() const noexcept -> std::size_t;
+    auto soft_limit() const noexcept -> std::size_t;
+
+    // Segments currently allocated, linked or on the free-list
+    auto segment_count() -> std::size_t;
+
+    // Marks one dequeued item as processed. Throws abc_error(errc::task_done_called_too_many_times)
+    // if there is no unfinished item. The call bringing the count to zero resumes every joiner.
+    auto task_done() -> void;
+
+    // Completes once every enqueued item has been marked done. Joiners are parked, not polled.
+    auto join() -> exec::task<void>;
+
+    // join() for threads outside any coroutine; blocks the calling thread.
+    auto join_blocking() -> void;
+};
+
+} // namespace abc::async
+
+#endif // ABC_INCLUDE_ABC_ASYNC_SEGMENTED_QUEUE_DECL
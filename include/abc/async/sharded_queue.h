@@ -0,0 +1,307 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_SHARDED_QUEUE
+#define ABC_INCLUDE_ABC_ASYNC_SHARDED_QUEUE
+
+#pragma once
+
+#include "queue.h"
+#include "sharded_queue_decl.h"
+
+#include "abc/error.h"
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace abc::async
+{
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+ShardedQueue<T, ShardCapacity, Scheduler>::ShardedQueue(Scheduler scheduler, std::size_t const shard_count)
+    : tallies_{ std::make_unique<Tally[]>(std::max<std::size_t>(shard_count, 1)) }, scheduler_{ scheduler }
+{
+    shards_.reserve(std::max<std::size_t>(shard_count, 1));
+    for (std::size_t i = 0; i < std::max<std::size_t>(shard_count, 1); ++i)
+    {
+        shards_.push_back(std::make_unique<Shard>(scheduler));
+    }
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+std::size_t
+ShardedQueue<T, ShardCapacity, Scheduler>::thread_slot() noexcept
+{
+    static std::atomic<std::size_t> next_slot{ 0 };
+    thread_local std::size_t const slot = next_slot.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+std::uint64_t
+ShardedQueue<T, ShardCapacity, Scheduler>::next_random() noexcept
+{
+    // Seeded from the slot so that threads start out on different victims
+    thread_local std::uint64_t state = (thread_slot() + 1) * 0x9E3779B97F4A7C15ull;
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+std::size_t
+ShardedQueue<T, ShardCapacity, Scheduler>::home_shard() const noexcept
+{
+    return thread_slot() % shards_.size();
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+bool
+ShardedQueue<T, ShardCapacity, Scheduler>::can_enqueue() const noexcept
+{
+    return std::any_of(shards_.begin(), shards_.end(), [](auto const & shard) { return !shard->full(); });
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+bool
+ShardedQueue<T, ShardCapacity, Scheduler>::can_dequeue() const noexcept
+{
+    return !empty();
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+std::int64_t
+ShardedQueue<T, ShardCapacity, Scheduler>::unfinished() const noexcept
+{
+    // An item is counted enqueued before it is published and marked done after it was dequeued,
+    // so once its done is seen here, the enqueued sum read afterwards includes it
+    std::uint64_t done = 0;
+    for (std::size_t i = 0; i < shards_.size(); ++i)
+    {
+        done += tallies_[i].done.load(std::memory_order_acquire);
+    }
+
+    std::uint64_t enqueued = 0;
+    for (std::size_t i = 0; i < shards_.size(); ++i)
+    {
+        enqueued += tallies_[i].enqueued.load(std::memory_order_relaxed);
+    }
+    return static_cast<std::int64_t>(enqueued - done);
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+bool
+ShardedQueue<T, ShardCapacity, Scheduler>::is_finished() const noexcept
+{
+    return unfinished() <= 0;
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+template <typename U>
+auto
+ShardedQueue<T, ShardCapacity, Scheduler>::do_enqueue(U && item) -> bool
+{
+    if constexpr (!std::is_nothrow_constructible_v<T, U &&>)
+    {
+        // A claimed cell cannot be handed back, so a constructor that may throw runs before claiming
+        static_assert(std::is_nothrow_move_constructible_v<T>, "ShardedQueue requires a non-throwing constructor from the item or a non-throwing move constructor");
+        T built(std::forward<U>(item));
+        return do_enqueue(std::move(built));
+    }
+    else
+    {
+        std::size_t const shard_count = shards_.size();
+        std::size_t const home = home_shard();
+        Tally & tally = tallies_[home];
+
+        // Only runs once a cell was claimed, so the item can be offered to every shard in turn
+        auto writer = [&tally, &item](std::size_t, T * slot) noexcept {
+            // Count the item before a consumer can see it, so its task_done() always finds it
+            tally.enqueued.fetch_add(1, std::memory_order_relaxed);
+            std::construct_at(slot, std::forward<U>(item));
+        };
+
+        for (std::size_t i = 0; i < shard_count; ++i)
+        {
+            if (shards_[(home + i) % shard_count]->template do_enqueue<false>(1, writer) == 1)
+            {
+                consumers_.notify_one();
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+bool
+ShardedQueue<T, ShardCapacity, Scheduler>::enqueue(T && item)
+{
+    return do_enqueue(std::move(item));
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+bool
+ShardedQueue<T, ShardCapacity, Scheduler>::enqueue(T const & item)
+{
+    return do_enqueue(item);
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+std::optional<T>
+ShardedQueue<T, ShardCapacity, Scheduler>::dequeue()
+{
+    std::size_t const shard_count = shards_.size();
+    std::size_t const home = home_shard();
+
+    std::optional<T> result;
+    auto const take = [&result](Shard & shard) {
+        return shard.template do_dequeue<false>(1, [&result](std::size_t, T & item) { result.emplace(std::move(item)); }) == 1;
+    };
+
+    if (!take(*shards_[home]) && shard_count > 1)
+    {
+        // Steal, visiting the other shards once starting at a random victim
+        std::size_t const first = static_cast<std::size_t>(next_random() % (shard_count - 1));
+        for (std::size_t i = 0; i < shard_count - 1; ++i)
+        {
+            std::size_t const victim = (home + 1 + (first + i) % (shard_count - 1)) % shard_count;
+            if (take(*shards_[victim]))
+            {
+                break;
+            }
+        }
+    }
+
+    if (result)
+    {
+        producers_.notify_one();
+    }
+    return result;
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+auto
+ShardedQueue<T, ShardCapacity, Scheduler>::async_enqueue(T item) -> exec::task<void>
+{
+    while (true)
+    {
+        if (enqueue(std::move(item)))
+        {
+            co_return;
+        }
+
+        // Every shard is full, park until a consumer frees a cell and retry
+        co_await Awaiter{ scheduler_, producers_, this, &ShardedQueue::can_enqueue };
+    }
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+auto
+ShardedQueue<T, ShardCapacity, Scheduler>::async_dequeue() -> exec::task<T>
+{
+    while (true)
+    {
+        auto result = dequeue();
+        if (result)
+        {
+            co_return std::move(*result);
+        }
+
+        // Every shard is empty, park until a producer publishes an item and retry
+        co_await Awaiter{ scheduler_, consumers_, this, &ShardedQueue::can_dequeue };
+    }
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+auto
+ShardedQueue<T, ShardCapacity, Scheduler>::enqueue_sender(T item) -> details::EnqueueSender<ShardedQueue, Scheduler, T>
+{
+    return { details::ParkSite<ShardedQueue, Scheduler>{ this, &scheduler_, &producers_, &ShardedQueue::can_enqueue }, std::move(item) };
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+auto
+ShardedQueue<T, ShardCapacity, Scheduler>::dequeue_sender() -> details::DequeueSender<ShardedQueue, Scheduler, T>
+{
+    return details::DequeueSender<ShardedQueue, Scheduler, T>{ details::ParkSite<ShardedQueue, Scheduler>{ this, &scheduler_, &consumers_, &ShardedQueue::can_dequeue } };
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+bool
+ShardedQueue<T, ShardCapacity, Scheduler>::empty() const noexcept
+{
+    return std::all_of(shards_.begin(), shards_.end(), [](auto const & shard) { return shard->empty(); });
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+std::size_t
+ShardedQueue<T, ShardCapacity, Scheduler>::size() const noexcept
+{
+    std::size_t size = 0;
+    for (auto const & shard : shards_)
+    {
+        size += shard->size();
+    }
+    return size;
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+std::size_t
+ShardedQueue<T, ShardCapacity, Scheduler>::capacity() const noexcept
+{
+    return ShardCapacity * shards_.size();
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+std::size_t
+ShardedQueue<T, ShardCapacity, Scheduler>::shard_count() const noexcept
+{
+    return shards_.size();
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+auto
+ShardedQueue<T, ShardCapacity, Scheduler>::task_done() -> void
+{
+    // Not atomic with the increment below, see the declaration
+    if (unfinished() <= 0)
+    {
+        throw_error(errc::task_done_called_too_many_times);
+    }
+    tallies_[home_shard()].done.fetch_add(1, std::memory_order_release);
+
+    // Pairs with the fence in WaiterList::park(): either a parking joiner sees this item done, or
+    // the joiner is seen here. Only then is it worth summing the tallies.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!joiners_.empty() && is_finished())
+    {
+        // Every task is done, release all joiners
+        joiners_.notify_all();
+    }
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+auto
+ShardedQueue<T, ShardCapacity, Scheduler>::join() -> exec::task<void>
+{
+    while (!is_finished())
+    {
+        co_await Awaiter{ scheduler_, joiners_, this, &ShardedQueue::is_finished };
+    }
+}
+
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+auto
+ShardedQueue<T, ShardCapacity, Scheduler>::join_blocking() -> void
+{
+    // There is no single counter to wait on, so wait for join() instead
+    stdexec::sync_wait(join());
+}
+
+} // namespace abc::async
+
+#endif // ABC_INCLUDE_ABC_ASYNC_SHARDED_QUEUE
@@ -0,0 +1,146 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_SHARDED_QUEUE_DECL
+#define ABC_INCLUDE_ABC_ASYNC_SHARDED_QUEUE_DECL
+
+#pragma once
+
+#include "queue_decl.h"
+#include "sharded_queue_fwd_decl.h"
+
+#include "details/park_awaiter.h"
+#include "details/queue_senders.h"
+#include "details/waiter_list.h"
+
+#include <exec/task.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace abc::async
+{
+
+// MPMC front-end over several independent `Queue` rings (shards), so that producers on
+// different threads do not contend on a single tail index.
+//
+// Every thread gets a home shard (threads are assigned round-robin on first use). Producers
+// enqueue into their home shard and only spill over to the other shards when it is full.
+// Consumers drain their home shard first, then steal from the other shards, starting at a
+// randomly chosen victim. There is no FIFO order across shards; items enqueued by one thread
+// into a non-full home shard are still dequeued in order.
+//
+// size(), task_done() and join() are global over all shards. The shards themselves neither
+// count items nor wake waiters: every thread tallies what it enqueues and marks done in its home
+// shard's own cache line, and join() sums the tallies. Only the front-end's waiter lists are
+// notified, which costs a fence and a read of a line that changes only while somebody parks.
+template <typename T, std::size_t ShardCapacity, stdexec::scheduler Scheduler>
+class ShardedQueue
+{
+private:
+    static constexpr std::size_t cache_line_size_in_bytes = 64; // Assuming 64-byte cache line size
+
+    using Shard = Queue<T, ShardCapacity, Scheduler>;
+
+    // Items enqueued and marked done by the threads of one home shard. Both only grow, so that
+    // summing every `done` before every `enqueued` never misses an item whose done was seen.
+    struct alignas(cache_line_size_in_bytes) Tally
+    {
+        std::atomic<std::uint64_t> enqueued{ 0 };
+        std::atomic<std::uint64_t> done{ 0 };
+    };
+
+    // Shards are only used through their untracked operations, the tallies replace their counts
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::unique_ptr<Tally[]> tallies_;
+
+    // Suspended producers (waiting for a free cell in any shard), consumers (waiting for an
+    // item in any shard) and joiners (waiting for every item to be done)
+    alignas(cache_line_size_in_bytes) details::WaiterList producers_;
+    alignas(cache_line_size_in_bytes) details::WaiterList consumers_;
+    alignas(cache_line_size_in_bytes) details::WaiterList joiners_;
+
+    Scheduler scheduler_;
+
+    // Parks the calling coroutine on one of the waiter lists, resumed through `scheduler_`
+    using Awaiter = details::ParkAwaiter<ShardedQueue, Scheduler>;
+
+    // Process-wide index of the calling thread, assigned on first use
+    static auto thread_slot() noexcept -> std::size_t;
+
+    // Per-thread xorshift generator choosing the first steal victim
+    static auto next_random() noexcept -> std::uint64_t;
+
+    auto home_shard() const noexcept -> std::size_t;
+
+    auto can_enqueue() const noexcept -> bool;
+    auto can_dequeue() const noexcept -> bool;
+
+    // Enqueued items not marked done yet, summed over the tallies. Items enqueued or done while
+    // summing may or may not be counted, but an item seen done is always seen enqueued.
+    auto unfinished() const noexcept -> std::int64_t;
+
+    // True when no enqueued item is waiting for task_done()
+    auto is_finished() const noexcept -> bool;
+
+    // Offer the item to the home shard, then to the others in order; wake a consumer on success.
+    // As in Queue::try_emplace(), T must be nothrow constructible from `U` or nothrow movable.
+    template <typename U>
+    auto do_enqueue(U && item) -> bool;
+
+public:
+    // `shard_count` defaults to the number of hardware threads; 0 is treated as 1
+    explicit ShardedQueue(Scheduler scheduler, std::size_t shard_count = std::thread::hardware_concurrency());
+
+    // Non-copyable, non-movable
+    ShardedQueue(ShardedQueue const &) = delete;
+    auto operator=(ShardedQueue const &) -> ShardedQueue & = delete;
+    ShardedQueue(ShardedQueue &&) = delete;
+    auto operator=(ShardedQueue &&) -> ShardedQueue & = delete;
+    ~ShardedQueue() = default;
+
+    // Async enqueue operation; waits only while every shard is full
+    auto async_enqueue(T item) -> exec::task<void>;
+
+    // Async dequeue operation; waits only while every shard is empty
+    auto async_dequeue() -> exec::task<T>;
+
+    // Sender versions of async_enqueue / async_dequeue, see Queue::enqueue_sender()
+    auto enqueue_sender(T item) -> details::EnqueueSender<ShardedQueue, Scheduler, T>;
+    auto dequeue_sender() -> details::DequeueSender<ShardedQueue, Scheduler, T>;
+
+    // Synchronous operations. Enqueue returns false only when every shard is full, dequeue
+    // returns std::nullopt only when every shard was found empty.
+    auto enqueue(T && item) -> bool;
+    auto enqueue(T const & item) -> bool;
+    auto dequeue() -> std::optional<T>;
+
+    // Query operations. With concurrent operations the results are only a snapshot.
+    auto empty() const noexcept -> bool;
+    auto size() const noexcept -> std::size_t;
+    auto capacity() const noexcept -> std::size_t;
+    auto shard_count() const noexcept -> std::size_t;
+
+    // Marks one dequeued item as processed. Throws abc_error(errc::task_done_called_too_many_times)
+    // if there is no unfinished item. The call bringing the count to zero resumes every joiner.
+    //
+    // Over-calling is only detected when it does not race: the check sums the tallies and the
+    // count then goes to the caller's own tally, so concurrent surplus calls can all pass. The
+    // surplus is not undone; it makes later items look done early, and join() may return before
+    // they are processed. Guarding against that would take a shared counter on every call.
+    auto task_done() -> void;
+
+    // Completes once every enqueued item has been marked done. Joiners are parked, not polled.
+    auto join() -> exec::task<void>;
+
+    // join() for threads outside any coroutine; blocks the calling thread.
+    auto join_blocking() -> void;
+};
+
+} // namespace abc::async
+
+#endif // ABC_INCLUDE_ABC_ASYNC_SHARDED_QUEUE_DECL
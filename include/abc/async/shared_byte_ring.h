@@ -0,0 +1,247 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_SHARED_BYTE_RING
+#define ABC_INCLUDE_ABC_ASYNC_SHARED_BYTE_RING
+
+#pragma once
+
+#include "shared_byte_ring_decl.h"
+
+#if defined(ABC_OS_LINUX)
+
+#include "abc/bytes_view.h"
+#include "abc/error.h"
+
+#include <cstring>
+#include <new>
+
+namespace abc::async
+{
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+SharedByteRing<Capacity, CardinalityV>::SharedByteRing(Layout * layout, std::uint64_t const generation) noexcept
+    : layout_{ layout }, generation_{ generation }, records_{ layout->words, &layout->head, &layout->tail }
+{
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+details::SharedRingGeometry
+SharedByteRing<Capacity, CardinalityV>::geometry() noexcept
+{
+    return details::SharedRingGeometry{
+        .kind = static_cast<std::uint32_t>(details::SharedRingKind::ByteRing),
+        .cardinality = static_cast<std::uint32_t>(CardinalityV),
+        .capacity = Capacity,
+        .element_size = 1,
+        .element_alignment = alignof(word_t),
+        .layout_size = sizeof(Layout),
+    };
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+typename SharedByteRing<Capacity, CardinalityV>::Layout *
+SharedByteRing<Capacity, CardinalityV>::layout_in(SharedMemory & memory)
+{
+    if (memory.size() < sizeof(Layout))
+    {
+        throw_error(make_error_code(errc::shared_memory_layout_mismatch));
+    }
+    return std::launder(reinterpret_cast<Layout *>(memory.data()));
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+void
+SharedByteRing<Capacity, CardinalityV>::throw_if_stale() const
+{
+    if (stale())
+    {
+        throw_error(make_error_code(errc::shared_memory_not_ready));
+    }
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+constexpr std::size_t
+SharedByteRing<Capacity, CardinalityV>::required_size() noexcept
+{
+    return sizeof(Layout);
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+auto
+SharedByteRing<Capacity, CardinalityV>::create(SharedMemory & memory) -> SharedByteRing
+{
+    Layout * layout = layout_in(memory);
+
+    layout->header.begin_initialize(geometry());
+    layout->head.store(0, std::memory_order_relaxed);
+    layout->tail.store(0, std::memory_order_relaxed);
+    std::memset(layout->words, 0, sizeof(layout->words));
+    std::uint64_t const generation = layout->header.end_initialize();
+
+    // Peers blocked on the previous ring wake up, find it stale and report it
+    layout->messages.notify_all();
+    layout->space.notify_all();
+    return SharedByteRing{ layout, generation };
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+auto
+SharedByteRing<Capacity, CardinalityV>::attach(SharedMemory & memory) -> SharedByteRing
+{
+    Layout * layout = layout_in(memory);
+    std::uint64_t const generation = layout->header.validate(geometry());
+    return SharedByteRing{ layout, generation };
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+auto
+SharedByteRing<Capacity, CardinalityV>::try_reserve(std::size_t const size) -> std::optional<std::span<byte_t>>
+{
+    return records_.try_reserve(size);
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+void
+SharedByteRing<Capacity, CardinalityV>::commit(std::span<byte_t> const reserved) noexcept
+{
+    records_.commit(reserved);
+    layout_->messages.notify(1);
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+bool
+SharedByteRing<Capacity, CardinalityV>::try_write(std::span<byte_t const> const message)
+{
+    auto reserved = try_reserve(message.size());
+    if (!reserved)
+    {
+        return false;
+    }
+
+    std::memcpy(reserved->data(), message.data(), message.size());
+    commit(*reserved);
+    return true;
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+auto
+SharedByteRing<Capacity, CardinalityV>::reserve_blocking(std::size_t const size) -> std::span<byte_t>
+{
+    while (true)
+    {
+        if (auto reserved = try_reserve(size))
+        {
+            return *reserved;
+        }
+
+        // Not enough space, sleep until the consumer has freed enough for this record and retry
+        std::size_t const length = Records::record_length(size);
+        layout_->space.wait([this, length] { return records_.fits(length) || stale(); });
+        throw_if_stale();
+    }
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+void
+SharedByteRing<Capacity, CardinalityV>::write_blocking(std::span<byte_t const> const message)
+{
+    std::span<byte_t> const reserved = reserve_blocking(message.size());
+    std::memcpy(reserved.data(), message.data(), message.size());
+    commit(reserved);
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+auto
+SharedByteRing<Capacity, CardinalityV>::try_read() -> std::optional<bytes_view<ByteNumbering::None>>
+{
+    return records_.try_read(reading_);
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+void
+SharedByteRing<Capacity, CardinalityV>::commit_read() noexcept
+{
+    if (reading_ == 0)
+    {
+        return;
+    }
+
+    records_.commit_read(reading_);
+    layout_->space.notify_all();
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+auto
+SharedByteRing<Capacity, CardinalityV>::read_blocking() -> bytes_view<ByteNumbering::None>
+{
+    while (true)
+    {
+        if (auto message = try_read())
+        {
+            return *message;
+        }
+        layout_->messages.wait([this] { return records_.readable(reading_) || stale(); });
+        throw_if_stale();
+    }
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+auto
+SharedByteRing<Capacity, CardinalityV>::read_for(std::chrono::steady_clock::duration const timeout) -> std::optional<bytes_view<ByteNumbering::None>>
+{
+    auto const deadline = std::chrono::steady_clock::now() + timeout;
+    while (true)
+    {
+        if (auto message = try_read())
+        {
+            return message;
+        }
+        if (!layout_->messages.wait([this] { return records_.readable(reading_) || stale(); }, deadline))
+        {
+            return std::nullopt;
+        }
+        throw_if_stale();
+    }
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+bool
+SharedByteRing<Capacity, CardinalityV>::empty() const noexcept
+{
+    return size() == 0;
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+std::size_t
+SharedByteRing<Capacity, CardinalityV>::size() const noexcept
+{
+    return records_.size();
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+constexpr std::size_t
+SharedByteRing<Capacity, CardinalityV>::capacity() const noexcept
+{
+    return Capacity;
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+constexpr std::size_t
+SharedByteRing<Capacity, CardinalityV>::max_message_size() const noexcept
+{
+    return Records::max_message_size;
+}
+
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+bool
+SharedByteRing<Capacity, CardinalityV>::stale() const noexcept
+{
+    return layout_->header.stale(generation_);
+}
+
+} // namespace abc::async
+
+#endif // ABC_OS_LINUX
+
+#endif // ABC_INCLUDE_ABC_ASYNC_SHARED_BYTE_RING
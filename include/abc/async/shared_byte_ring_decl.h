@@ -0,0 +1,122 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_SHARED_BYTE_RING_DECL
+#define ABC_INCLUDE_ABC_ASYNC_SHARED_BYTE_RING_DECL
+
+#pragma once
+
+#include "abc/byte.h"
+#include "abc/bytes_view_decl.h"
+#include "abc/details/config.h"
+#include "shared_byte_ring_fwd_decl.h"
+
+#if defined(ABC_OS_LINUX)
+
+#include "abc/shared_memory.h"
+
+#include "details/byte_records.h"
+#include "details/futex.h"
+#include "details/shared_ring_header.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+namespace abc::async
+{
+
+// ByteRing in shared memory: variable-length messages written in place by producers of any
+// process and read in place by a single consumer. The records have the same format as ByteRing's
+// (see details::ByteRecords). Creation, attaching, header validation, stale() and futex-based
+// blocking work as for SharedQueue. What the consumer has read but not committed is tracked by
+// its handle, so a re-attached consumer starts over at the oldest uncommitted message.
+template <std::size_t Capacity, QueueCardinality CardinalityV>
+class SharedByteRing
+{
+private:
+    static_assert(CardinalityV == QueueCardinality::Mpsc || CardinalityV == QueueCardinality::Spsc, "SharedByteRing has a single consumer");
+
+    static constexpr bool multi_producer = CardinalityV == QueueCardinality::Mpsc;
+    static constexpr std::size_t cache_line_size_in_bytes = 64; // Assuming 64-byte cache line size
+
+    using Records = details::ByteRecords<Capacity, multi_producer>;
+    using word_t = typename Records::word_t;
+
+    struct Layout
+    {
+        details::SharedRingHeader header;
+        alignas(cache_line_size_in_bytes) std::atomic<std::size_t> head;
+        alignas(cache_line_size_in_bytes) std::atomic<std::size_t> tail;
+        alignas(cache_line_size_in_bytes) details::FutexEvent messages;
+        alignas(cache_line_size_in_bytes) details::FutexEvent space;
+        alignas(cache_line_size_in_bytes) word_t words[Capacity / sizeof(word_t)];
+    };
+
+    Layout * layout_;
+    std::uint64_t generation_;
+    Records records_;
+
+    // Consumer-private: bytes taken by the message handed out by try_read(), 0 if none
+    std::size_t reading_{ 0 };
+
+    SharedByteRing(Layout * layout, std::uint64_t generation) noexcept;
+
+    static auto geometry() noexcept -> details::SharedRingGeometry;
+    static auto layout_in(SharedMemory & memory) -> Layout *;
+
+    auto throw_if_stale() const -> void;
+
+public:
+    SharedByteRing(SharedByteRing const &) = delete;
+    auto operator=(SharedByteRing const &) -> SharedByteRing & = delete;
+    SharedByteRing(SharedByteRing &&) noexcept = default;
+    auto operator=(SharedByteRing &&) noexcept -> SharedByteRing & = default;
+    ~SharedByteRing() = default;
+
+    // Bytes of shared memory the ring takes
+    static constexpr auto required_size() noexcept -> std::size_t;
+
+    // See SharedQueue::create() / SharedQueue::attach()
+    static auto create(SharedMemory & memory) -> SharedByteRing;
+    static auto attach(SharedMemory & memory) -> SharedByteRing;
+
+    // Producer side, as ByteRing. Throws abc_error(errc::message_too_large) when `size` exceeds
+    // max_message_size().
+    auto try_reserve(std::size_t size) -> std::optional<std::span<byte_t>>;
+    auto commit(std::span<byte_t> reserved) noexcept -> void;
+    auto try_write(std::span<byte_t const> message) -> bool;
+
+    // Blocking producer side. Throws abc_error(errc::shared_memory_not_ready) if the ring is
+    // re-created while waiting.
+    auto reserve_blocking(std::size_t size) -> std::span<byte_t>;
+    auto write_blocking(std::span<byte_t const> message) -> void;
+
+    // Consumer side, as ByteRing: the view is valid until commit_read()
+    auto try_read() -> std::optional<bytes_view<ByteNumbering::None>>;
+    auto commit_read() noexcept -> void;
+
+    // Blocking consumer side; read_for() returns std::nullopt when `timeout` expires
+    auto read_blocking() -> bytes_view<ByteNumbering::None>;
+    auto read_for(std::chrono::steady_clock::duration timeout) -> std::optional<bytes_view<ByteNumbering::None>>;
+
+    // Query operations
+    auto empty() const noexcept -> bool;
+
+    // Bytes in use, headers and padding included
+    auto size() const noexcept -> std::size_t;
+
+    constexpr auto capacity() const noexcept -> std::size_t;
+    constexpr auto max_message_size() const noexcept -> std::size_t;
+
+    // True once the ring this handle attached to has been re-created (or is being re-created)
+    auto stale() const noexcept -> bool;
+};
+
+} // namespace abc::async
+
+#endif // ABC_OS_LINUX
+
+#endif // ABC_INCLUDE_ABC_ASYNC_SHARED_BYTE_RING_DECL
@@ -0,0 +1,304 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_SHARED_QUEUE
+#define ABC_INCLUDE_ABC_ASYNC_SHARED_QUEUE
+
+#pragma once
+
+#include "shared_queue_decl.h"
+
+#if defined(ABC_OS_LINUX)
+
+#include "abc/error.h"
+
+#include <bit>
+#include <cstring>
+#include <new>
+
+namespace abc::async
+{
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+SharedQueue<T, Capacity, CardinalityV>::SharedQueue(Layout * layout, std::uint64_t const generation) noexcept : layout_{ layout }, generation_{ generation }
+{
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+details::SharedRingGeometry
+SharedQueue<T, Capacity, CardinalityV>::geometry() noexcept
+{
+    return details::SharedRingGeometry{
+        .kind = static_cast<std::uint32_t>(details::SharedRingKind::Queue),
+        .cardinality = static_cast<std::uint32_t>(CardinalityV),
+        .capacity = Capacity,
+        .element_size = sizeof(T),
+        .element_alignment = alignof(T),
+        .layout_size = sizeof(Layout),
+    };
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+typename SharedQueue<T, Capacity, CardinalityV>::Layout *
+SharedQueue<T, Capacity, CardinalityV>::layout_in(SharedMemory & memory)
+{
+    if (memory.size() < sizeof(Layout))
+    {
+        throw_error(make_error_code(errc::shared_memory_layout_mismatch));
+    }
+    return std::launder(reinterpret_cast<Layout *>(memory.data()));
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+std::size_t
+SharedQueue<T, Capacity, CardinalityV>::load_sequence(std::size_t const pos) const noexcept
+{
+    std::size_t const index = pos & (Capacity - 1);
+    return std::atomic_ref<std::size_t>{ layout_->cells[index].sequence }.load(std::memory_order_acquire) + index;
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+void
+SharedQueue<T, Capacity, CardinalityV>::store_sequence(std::size_t const pos, std::size_t const sequence) const noexcept
+{
+    std::size_t const index = pos & (Capacity - 1);
+    std::atomic_ref<std::size_t>{ layout_->cells[index].sequence }.store(sequence - index, std::memory_order_release);
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+bool
+SharedQueue<T, Capacity, CardinalityV>::can_enqueue() const noexcept
+{
+    std::size_t const pos = layout_->tail.load(std::memory_order_relaxed);
+    return (intptr_t)load_sequence(pos) - (intptr_t)pos >= 0 || stale();
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+bool
+SharedQueue<T, Capacity, CardinalityV>::can_dequeue() const noexcept
+{
+    std::size_t const pos = layout_->head.load(std::memory_order_relaxed);
+    return (intptr_t)load_sequence(pos) - (intptr_t)(pos + 1) >= 0 || stale();
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+void
+SharedQueue<T, Capacity, CardinalityV>::throw_if_stale() const
+{
+    if (stale())
+    {
+        throw_error(make_error_code(errc::shared_memory_not_ready));
+    }
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+constexpr std::size_t
+SharedQueue<T, Capacity, CardinalityV>::required_size() noexcept
+{
+    return sizeof(Layout);
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+auto
+SharedQueue<T, Capacity, CardinalityV>::create(SharedMemory & memory) -> SharedQueue
+{
+    Layout * layout = layout_in(memory);
+
+    layout->header.begin_initialize(geometry());
+    layout->head.store(0, std::memory_order_relaxed);
+    layout->tail.store(0, std::memory_order_relaxed);
+    std::memset(static_cast<void *>(layout->cells), 0, sizeof(layout->cells));
+    std::uint64_t const generation = layout->header.end_initialize();
+
+    // Peers blocked on the previous ring wake up, find it stale and report it
+    layout->items.notify_all();
+    layout->space.notify_all();
+    return SharedQueue{ layout, generation };
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+auto
+SharedQueue<T, Capacity, CardinalityV>::attach(SharedMemory & memory) -> SharedQueue
+{
+    Layout * layout = layout_in(memory);
+    std::uint64_t const generation = layout->header.validate(geometry());
+    return SharedQueue{ layout, generation };
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+bool
+SharedQueue<T, Capacity, CardinalityV>::enqueue(T const & item)
+{
+    std::size_t pos = layout_->tail.load(std::memory_order_relaxed);
+    while (true)
+    {
+        // A cell is free for sequence number `pos` exactly when its own sequence equals it
+        intptr_t const diff = (intptr_t)load_sequence(pos) - (intptr_t)pos;
+        if (diff < 0)
+        {
+            // Queue is full
+            return false;
+        }
+
+        if (diff > 0)
+        {
+            // Another producer claimed the cell, get updated position
+            pos = layout_->tail.load(std::memory_order_relaxed);
+        }
+        else if constexpr (multi_producer)
+        {
+            if (layout_->tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else
+        {
+            layout_->tail.store(pos + 1, std::memory_order_relaxed);
+            break;
+        }
+    }
+
+    layout_->cells[pos & (Capacity - 1)].storage = std::bit_cast<std::array<byte_t, sizeof(T)>>(item);
+    store_sequence(pos, pos + 1);
+    layout_->items.notify(1);
+    return true;
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+auto
+SharedQueue<T, Capacity, CardinalityV>::dequeue() -> std::optional<T>
+{
+    std::size_t pos = layout_->head.load(std::memory_order_relaxed);
+    while (true)
+    {
+        intptr_t const diff = (intptr_t)load_sequence(pos) - (intptr_t)(pos + 1);
+        if (diff < 0)
+        {
+            // Queue is empty
+            return std::nullopt;
+        }
+
+        if (diff > 0)
+        {
+            // Another consumer claimed the cell, get updated position
+            pos = layout_->head.load(std::memory_order_relaxed);
+        }
+        else if constexpr (multi_consumer)
+        {
+            if (layout_->head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else
+        {
+            layout_->head.store(pos + 1, std::memory_order_relaxed);
+            break;
+        }
+    }
+
+    T const item = std::bit_cast<T>(layout_->cells[pos & (Capacity - 1)].storage);
+
+    // Mark the cell as empty
+    store_sequence(pos, pos + Capacity);
+    layout_->space.notify(1);
+    return item;
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+void
+SharedQueue<T, Capacity, CardinalityV>::enqueue_blocking(T const & item)
+{
+    while (!enqueue(item))
+    {
+        layout_->space.wait([this] { return can_enqueue(); });
+        throw_if_stale();
+    }
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+T
+SharedQueue<T, Capacity, CardinalityV>::dequeue_blocking()
+{
+    while (true)
+    {
+        if (auto item = dequeue())
+        {
+            return *item;
+        }
+        layout_->items.wait([this] { return can_dequeue(); });
+        throw_if_stale();
+    }
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+bool
+SharedQueue<T, Capacity, CardinalityV>::enqueue_for(T const & item, std::chrono::steady_clock::duration const timeout)
+{
+    auto const deadline = std::chrono::steady_clock::now() + timeout;
+    while (!enqueue(item))
+    {
+        if (!layout_->space.wait([this] { return can_enqueue(); }, deadline))
+        {
+            return false;
+        }
+        throw_if_stale();
+    }
+    return true;
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+auto
+SharedQueue<T, Capacity, CardinalityV>::dequeue_for(std::chrono::steady_clock::duration const timeout) -> std::optional<T>
+{
+    auto const deadline = std::chrono::steady_clock::now() + timeout;
+    while (true)
+    {
+        if (auto item = dequeue())
+        {
+            return item;
+        }
+        if (!layout_->items.wait([this] { return can_dequeue(); }, deadline))
+        {
+            return std::nullopt;
+        }
+        throw_if_stale();
+    }
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+bool
+SharedQueue<T, Capacity, CardinalityV>::empty() const noexcept
+{
+    return size() == 0;
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+std::size_t
+SharedQueue<T, Capacity, CardinalityV>::size() const noexcept
+{
+    // The head never passes the tail, so loading it first keeps the difference non-negative
+    std::size_t const head = layout_->head.load(std::memory_order_acquire);
+    return layout_->tail.load(std::memory_order_acquire) - head;
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+constexpr std::size_t
+SharedQueue<T, Capacity, CardinalityV>::capacity() const noexcept
+{
+    return Capacity;
+}
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+bool
+SharedQueue<T, Capacity, CardinalityV>::stale() const noexcept
+{
+    return layout_->header.stale(generation_);
+}
+
+} // namespace abc::async
+
+#endif // ABC_OS_LINUX
+
+#endif // ABC_INCLUDE_ABC_ASYNC_SHARED_QUEUE
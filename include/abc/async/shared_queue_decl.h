@@ -0,0 +1,140 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_SHARED_QUEUE_DECL
+#define ABC_INCLUDE_ABC_ASYNC_SHARED_QUEUE_DECL
+
+#pragma once
+
+#include "abc/byte.h"
+#include "abc/details/config.h"
+#include "shared_queue_fwd_decl.h"
+
+#if defined(ABC_OS_LINUX)
+
+#include "abc/shared_memory.h"
+
+#include "details/futex.h"
+#include "details/shared_ring_header.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+namespace abc::async
+{
+
+// Bounded lock-free queue living in shared memory, for passing trivially copyable items between
+// processes. The ring uses the same sequence-numbered cells as Queue; `CardinalityV` only decides
+// which index is claimed with a CAS (the shared sides) and which with a plain store.
+//
+// One process create()s the ring in a SharedMemory segment of at least required_size() bytes,
+// the others attach() to it; every handle refers to the segment, which must outlive it. Waiting
+// is done with futexes in the segment, so blocked producers and consumers of any process are
+// woken by peers of any other, and the fast paths never make a system call.
+//
+// The header records the ring's format and geometry, and whether initialization completed:
+// attaching to a half-initialized, foreign or differently shaped segment throws. Re-creating the
+// ring (e.g. after a peer died mid-operation, which can leave a claimed cell unpublished) bumps
+// its generation: handles of the previous ring report stale() and their blocking calls throw.
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV>
+class SharedQueue
+{
+private:
+    static_assert(std::is_trivially_copyable_v<T>, "Items crossing process boundaries must be trivially copyable");
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
+    static_assert(std::atomic_ref<std::size_t>::is_always_lock_free, "Cell sequences must be lock-free");
+
+    static constexpr bool multi_producer = CardinalityV == QueueCardinality::Mpmc || CardinalityV == QueueCardinality::Mpsc;
+    static constexpr bool multi_consumer = CardinalityV == QueueCardinality::Mpmc || CardinalityV == QueueCardinality::Spmc;
+
+    static constexpr std::size_t cache_line_size_in_bytes = 64; // Assuming 64-byte cache line size
+
+    // The sequence is accessed through std::atomic_ref and stored relative to the cell's index,
+    // so zero-filled memory is an empty ring
+    struct Cell
+    {
+        mutable std::size_t sequence;
+        std::array<byte_t, sizeof(T)> storage;
+    };
+
+    // Everything in the segment. A new segment is zero-filled, which is a valid state for every
+    // field; create() still resets the indices and cells to reuse an old one.
+    struct Layout
+    {
+        details::SharedRingHeader header;
+        alignas(cache_line_size_in_bytes) std::atomic<std::size_t> head;
+        alignas(cache_line_size_in_bytes) std::atomic<std::size_t> tail;
+        alignas(cache_line_size_in_bytes) details::FutexEvent items;
+        alignas(cache_line_size_in_bytes) details::FutexEvent space;
+        alignas(cache_line_size_in_bytes) Cell cells[Capacity];
+    };
+
+    Layout * layout_;
+    std::uint64_t generation_;
+
+    SharedQueue(Layout * layout, std::uint64_t generation) noexcept;
+
+    static auto geometry() noexcept -> details::SharedRingGeometry;
+
+    // Throws abc_error(errc::shared_memory_layout_mismatch) when the segment is too small
+    static auto layout_in(SharedMemory & memory) -> Layout *;
+
+    auto load_sequence(std::size_t pos) const noexcept -> std::size_t;
+    auto store_sequence(std::size_t pos, std::size_t sequence) const noexcept -> void;
+
+    // True when a retry may succeed, or the ring was replaced (which blocking calls report)
+    auto can_enqueue() const noexcept -> bool;
+    auto can_dequeue() const noexcept -> bool;
+
+    auto throw_if_stale() const -> void;
+
+public:
+    SharedQueue(SharedQueue const &) = delete;
+    auto operator=(SharedQueue const &) -> SharedQueue & = delete;
+    SharedQueue(SharedQueue &&) noexcept = default;
+    auto operator=(SharedQueue &&) noexcept -> SharedQueue & = default;
+    ~SharedQueue() = default;
+
+    // Bytes of shared memory the ring takes
+    static constexpr auto required_size() noexcept -> std::size_t;
+
+    // (Re-)initializes the ring in `memory`, waking whoever blocked on a previous ring there
+    static auto create(SharedMemory & memory) -> SharedQueue;
+
+    // Attaches to the ring another process created. Throws abc_error(errc::shared_memory_not_ready)
+    // when `memory` holds no completely initialized ring, abc_error(errc::shared_memory_layout_mismatch)
+    // when it holds a ring of another format, type or geometry.
+    static auto attach(SharedMemory & memory) -> SharedQueue;
+
+    // Non-blocking operations; false / std::nullopt when full / empty
+    auto enqueue(T const & item) -> bool;
+    auto dequeue() -> std::optional<T>;
+
+    // Blocking operations. They throw abc_error(errc::shared_memory_not_ready) if the ring is
+    // re-created while they wait.
+    auto enqueue_blocking(T const & item) -> void;
+    auto dequeue_blocking() -> T;
+
+    // Blocking with a timeout; false / std::nullopt when it expires
+    auto enqueue_for(T const & item, std::chrono::steady_clock::duration timeout) -> bool;
+    auto dequeue_for(std::chrono::steady_clock::duration timeout) -> std::optional<T>;
+
+    // Query operations
+    auto empty() const noexcept -> bool;
+    auto size() const noexcept -> std::size_t;
+
+    constexpr auto capacity() const noexcept -> std::size_t;
+
+    // True once the ring this handle attached to has been re-created (or is being re-created)
+    auto stale() const noexcept -> bool;
+};
+
+} // namespace abc::async
+
+#endif // ABC_OS_LINUX
+
+#endif // ABC_INCLUDE_ABC_ASYNC_SHARED_QUEUE_DECL
@@ -0,0 +1,21 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_SHARED_QUEUE_FWD_DECL
+#define ABC_INCLUDE_ABC_ASYNC_SHARED_QUEUE_FWD_DECL
+
+#pragma once
+
+#include "queue_fwd_decl.h"
+
+#include <cstddef>
+
+namespace abc::async
+{
+
+template <typename T, std::size_t Capacity, QueueCardinality CardinalityV = QueueCardinality::Mpmc>
+class SharedQueue;
+
+}
+
+#endif // ABC_INCLUDE_ABC_ASYNC_SHARED_QUEUE_FWD_DECL
@@ -0,0 +1,226 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_SPILL_QUEUE
+#define ABC_INCLUDE_ABC_ASYNC_SPILL_QUEUE
+
+#pragma once
+
+#include "spill_queue_decl.h"
+
+#if defined(ABC_OS_LINUX)
+
+#include "queue.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace abc::async
+{
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+SpillQueue<T, Capacity, Scheduler, CardinalityV>::SpillQueue(Scheduler scheduler, std::string const & spill_directory, std::size_t const initial_spill_size)
+    : ring_{ scheduler }, spill_{ MappedFile::temporary(spill_directory, std::max(initial_spill_size, record_length(0))) }
+{
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+std::size_t
+SpillQueue<T, Capacity, Scheduler, CardinalityV>::record_length(std::size_t const size) noexcept
+{
+    return sizeof(RecordHeader) + (size + 7) / 8 * 8;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+void
+SpillQueue<T, Capacity, Scheduler, CardinalityV>::spill_locked(T const & item)
+{
+    std::size_t const size = Codec::size(item);
+    std::size_t const length = record_length(size);
+
+    if (spill_write_ + length > spill_.size())
+    {
+        // Reuse the drained front of the file before growing it
+        if (spill_read_ != 0 && spill_write_ - spill_read_ + length <= spill_.size())
+        {
+            std::memmove(spill_.data(), spill_.data() + spill_read_, spill_write_ - spill_read_);
+            spill_write_ -= spill_read_;
+            spill_read_ = 0;
+        }
+        else
+        {
+            std::size_t new_size = spill_.size() * 2;
+            while (spill_write_ + length > new_size)
+            {
+                new_size *= 2;
+            }
+            spill_.resize(new_size);
+        }
+    }
+
+    RecordHeader const header{ size, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count() };
+    byte_t * const record = spill_.data() + spill_write_;
+    std::memcpy(record, &header, sizeof(header));
+    Codec::write(item, std::span<byte_t>{ record + sizeof(header), size });
+    spill_write_ += length;
+
+    pending_items_.fetch_add(1, std::memory_order_relaxed);
+    pending_bytes_.fetch_add(size, std::memory_order_relaxed);
+    spilled_items_.fetch_add(1, std::memory_order_relaxed);
+    spilled_bytes_.fetch_add(size, std::memory_order_relaxed);
+    spilling_.store(true, std::memory_order_release);
+
+    drain_locked();
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+void
+SpillQueue<T, Capacity, Scheduler, CardinalityV>::drain_locked()
+{
+    std::int64_t const now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    while (spill_read_ != spill_write_ && !ring_.full())
+    {
+        RecordHeader header;
+        byte_t const * const record = spill_.data() + spill_read_;
+        std::memcpy(&header, record, sizeof(header));
+
+        // A failed enqueue leaves the item alone; it is decoded again on the next drain
+        if (!ring_.enqueue(Codec::read(std::span<byte_t const>{ record + sizeof(header), header.size })))
+        {
+            break;
+        }
+        spill_read_ += record_length(header.size);
+
+        pending_items_.fetch_sub(1, std::memory_order_relaxed);
+        pending_bytes_.fetch_sub(header.size, std::memory_order_relaxed);
+        drained_items_.fetch_add(1, std::memory_order_relaxed);
+        drained_bytes_.fetch_add(header.size, std::memory_order_relaxed);
+
+        std::int64_t const latency = now - header.spilled_at;
+        total_spill_latency_.fetch_add(latency, std::memory_order_relaxed);
+        if (latency > max_spill_latency_.load(std::memory_order_relaxed))
+        {
+            max_spill_latency_.store(latency, std::memory_order_relaxed);
+        }
+    }
+
+    if (spill_read_ == spill_write_)
+    {
+        spill_read_ = 0;
+        spill_write_ = 0;
+        spilling_.store(false, std::memory_order_release);
+    }
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+void
+SpillQueue<T, Capacity, Scheduler, CardinalityV>::drain()
+{
+    // Blocking rather than try_lock: a skipped drain could be the last one before consumers park
+    std::lock_guard lock{ spill_mutex_ };
+    drain_locked();
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+void
+SpillQueue<T, Capacity, Scheduler, CardinalityV>::enqueue(T && item)
+{
+    // Once anything is spilled, later items queue up behind it in the file
+    if (!spilling_.load(std::memory_order_acquire) && ring_.enqueue(std::move(item)))
+    {
+        return;
+    }
+
+    std::lock_guard lock{ spill_mutex_ };
+    if (!spilling_.load(std::memory_order_relaxed) && ring_.enqueue(std::move(item)))
+    {
+        return;
+    }
+    spill_locked(item);
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+void
+SpillQueue<T, Capacity, Scheduler, CardinalityV>::enqueue(T const & item)
+{
+    enqueue(T{ item });
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+auto
+SpillQueue<T, Capacity, Scheduler, CardinalityV>::dequeue() -> std::optional<T>
+{
+    std::optional<T> item = ring_.dequeue();
+    if (spilling_.load(std::memory_order_acquire))
+    {
+        drain();
+        if (!item)
+        {
+            item = ring_.dequeue();
+        }
+    }
+    return item;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+auto
+SpillQueue<T, Capacity, Scheduler, CardinalityV>::async_dequeue() -> exec::task<T>
+{
+    if (auto item = dequeue())
+    {
+        co_return std::move(*item);
+    }
+
+    // The spill file is empty here, and a producer spilling later drains into the ring right
+    // away, which wakes this consumer
+    T item = co_await ring_.async_dequeue();
+    if (spilling_.load(std::memory_order_acquire))
+    {
+        drain();
+    }
+    co_return item;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+bool
+SpillQueue<T, Capacity, Scheduler, CardinalityV>::empty() const noexcept
+{
+    return size() == 0;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+std::size_t
+SpillQueue<T, Capacity, Scheduler, CardinalityV>::size() const noexcept
+{
+    return ring_.size() + pending_items_.load(std::memory_order_relaxed);
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+constexpr std::size_t
+SpillQueue<T, Capacity, Scheduler, CardinalityV>::capacity() const noexcept
+{
+    return Capacity;
+}
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+SpillStats
+SpillQueue<T, Capacity, Scheduler, CardinalityV>::spill_stats() const noexcept
+{
+    return SpillStats{
+        .spilled_items = spilled_items_.load(std::memory_order_relaxed),
+        .spilled_bytes = spilled_bytes_.load(std::memory_order_relaxed),
+        .drained_items = drained_items_.load(std::memory_order_relaxed),
+        .drained_bytes = drained_bytes_.load(std::memory_order_relaxed),
+        .total_spill_latency = std::chrono::nanoseconds{ total_spill_latency_.load(std::memory_order_relaxed) },
+        .max_spill_latency = std::chrono::nanoseconds{ max_spill_latency_.load(std::memory_order_relaxed) },
+        .pending_items = pending_items_.load(std::memory_order_relaxed),
+        .pending_bytes = pending_bytes_.load(std::memory_order_relaxed),
+    };
+}
+
+} // namespace abc::async
+
+#endif // ABC_OS_LINUX
+
+#endif // ABC_INCLUDE_ABC_ASYNC_SPILL_QUEUE
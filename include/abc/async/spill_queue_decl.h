@@ -0,0 +1,204 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_SPILL_QUEUE_DECL
+#define ABC_INCLUDE_ABC_ASYNC_SPILL_QUEUE_DECL
+
+#pragma once
+
+#include "abc/byte.h"
+#include "abc/bytes_decl.h"
+#include "abc/details/config.h"
+#include "spill_queue_fwd_decl.h"
+
+#if defined(ABC_OS_LINUX)
+
+#include "abc/mapped_file.h"
+#include "queue_decl.h"
+
+#include <exec/task.hpp>
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+
+namespace abc::async
+{
+
+template <typename T>
+    requires std::is_trivially_copyable_v<T>
+struct SpillCodec<T>
+{
+    static constexpr auto
+    size(T const &) noexcept -> std::size_t
+    {
+        return sizeof(T);
+    }
+
+    static auto
+    write(T const & item, std::span<byte_t> const out) noexcept -> void
+    {
+        std::memcpy(out.data(), &item, sizeof(T));
+    }
+
+    static auto
+    read(std::span<byte_t const> const in) noexcept -> T
+    {
+        std::array<byte_t, sizeof(T)> bytes;
+        std::memcpy(bytes.data(), in.data(), sizeof(T));
+        return std::bit_cast<T>(bytes);
+    }
+};
+
+template <ByteNumbering ByteNumberingV>
+struct SpillCodec<BasicBytes<ByteNumberingV>>
+{
+    static auto
+    size(BasicBytes<ByteNumberingV> const & item) noexcept -> std::size_t
+    {
+        return item.size();
+    }
+
+    static auto
+    write(BasicBytes<ByteNumberingV> const & item, std::span<byte_t> const out) noexcept -> void
+    {
+        std::memcpy(out.data(), item.data(), item.size());
+    }
+
+    static auto
+    read(std::span<byte_t const> const in) -> BasicBytes<ByteNumberingV>
+    {
+        return BasicBytes<ByteNumberingV>::template from<ByteNumberingV>(in.begin(), in.end());
+    }
+};
+
+template <typename T>
+concept spill_codec_for = requires(T const & item, std::span<byte_t> out, std::span<byte_t const> in) {
+    { SpillCodec<T>::size(item) } -> std::convertible_to<std::size_t>;
+    SpillCodec<T>::write(item, out);
+    { SpillCodec<T>::read(in) } -> std::convertible_to<T>;
+};
+
+// Counters of a SpillQueue's overflow tier, all since construction. A drain rate is the
+// difference of `drained_items` between two snapshots over the time between them.
+struct SpillStats
+{
+    std::uint64_t spilled_items;
+    std::uint64_t spilled_bytes;
+    std::uint64_t drained_items;
+    std::uint64_t drained_bytes;
+
+    // Time items spent in the spill file, summed over and maximum of the drained items
+    std::chrono::nanoseconds total_spill_latency;
+    std::chrono::nanoseconds max_spill_latency;
+
+    // Items and bytes currently in the spill file
+    std::size_t pending_items;
+    std::size_t pending_bytes;
+};
+
+// Unbounded front-end over `Queue` absorbing bursts into a memory-mapped spill file instead of
+// failing (or blocking) producers.
+//
+// While the ring has room items go through it as usual. Once it is full, items are serialized
+// with SpillCodec<T> and appended to the spill file, and every later item follows them there
+// until the file is drained: each operation finding free cells moves spilled items back into
+// the ring, oldest first, under a mutex. Items of one producer are therefore dequeued in order.
+// Only the spill path takes the mutex; the file is unnamed and removed with the queue.
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV>
+class SpillQueue
+{
+private:
+    static_assert(spill_codec_for<T>, "SpillQueue needs a SpillCodec<T> specialization");
+
+    static constexpr std::size_t cache_line_size_in_bytes = 64; // Assuming 64-byte cache line size
+
+    using Codec = SpillCodec<T>;
+    using Ring = Queue<T, Capacity, Scheduler, CardinalityV>;
+
+    // Every record in the spill file: this header, then the payload padded to 8 bytes
+    struct RecordHeader
+    {
+        std::uint64_t size;
+        std::int64_t spilled_at; // steady_clock nanoseconds
+    };
+
+    Ring ring_;
+
+    // True while the spill file holds items; producers then append instead of using the ring
+    alignas(cache_line_size_in_bytes) std::atomic<bool> spilling_{ false };
+
+    // Spill file and its read / write offsets, guarded by `spill_mutex_`
+    alignas(cache_line_size_in_bytes) std::mutex spill_mutex_;
+    MappedFile spill_;
+    std::size_t spill_read_{ 0 };
+    std::size_t spill_write_{ 0 };
+
+    alignas(cache_line_size_in_bytes) std::atomic<std::size_t> pending_items_{ 0 };
+    std::atomic<std::size_t> pending_bytes_{ 0 };
+    std::atomic<std::uint64_t> spilled_items_{ 0 };
+    std::atomic<std::uint64_t> spilled_bytes_{ 0 };
+    std::atomic<std::uint64_t> drained_items_{ 0 };
+    std::atomic<std::uint64_t> drained_bytes_{ 0 };
+    std::atomic<std::int64_t> total_spill_latency_{ 0 };
+    std::atomic<std::int64_t> max_spill_latency_{ 0 };
+
+    static auto record_length(std::size_t size) noexcept -> std::size_t;
+
+    // Appends `item` to the spill file, then drains what fits. Called with the mutex held.
+    auto spill_locked(T const & item) -> void;
+
+    // Moves spilled items into the ring while it has room. Called with the mutex held.
+    auto drain_locked() -> void;
+
+    auto drain() -> void;
+
+public:
+    // The spill file is created in `spill_directory`, starting at `initial_spill_size` bytes and
+    // doubling as needed
+    explicit SpillQueue(Scheduler scheduler,
+                        std::string const & spill_directory = std::filesystem::temp_directory_path().string(),
+                        std::size_t initial_spill_size = std::size_t{ 1 } << 20);
+
+    // Non-copyable, non-movable
+    SpillQueue(SpillQueue const &) = delete;
+    auto operator=(SpillQueue const &) -> SpillQueue & = delete;
+    SpillQueue(SpillQueue &&) = delete;
+    auto operator=(SpillQueue &&) -> SpillQueue & = delete;
+    ~SpillQueue() = default;
+
+    // Never fails for lack of room: a full ring spills. Throws only if the spill file cannot grow.
+    auto enqueue(T && item) -> void;
+    auto enqueue(T const & item) -> void;
+
+    auto dequeue() -> std::optional<T>;
+
+    // dequeue() waiting (parked) while both the ring and the spill file are empty
+    auto async_dequeue() -> exec::task<T>;
+
+    // Query operations. With concurrent operations the results are only a snapshot.
+    auto empty() const noexcept -> bool;
+
+    // Items in the ring and in the spill file
+    auto size() const noexcept -> std::size_t;
+
+    constexpr auto capacity() const noexcept -> std::size_t;
+
+    auto spill_stats() const noexcept -> SpillStats;
+};
+
+} // namespace abc::async
+
+#endif // ABC_OS_LINUX
+
+#endif // ABC_INCLUDE_ABC_ASYNC_SPILL_QUEUE_DECL
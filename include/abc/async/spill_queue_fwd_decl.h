@@ -0,0 +1,31 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_SPILL_QUEUE_FWD_DECL
+#define ABC_INCLUDE_ABC_ASYNC_SPILL_QUEUE_FWD_DECL
+
+#pragma once
+
+#include "queue_fwd_decl.h"
+
+#include <stdexec/execution.hpp>
+
+#include <cstddef>
+
+namespace abc::async
+{
+
+// How SpillQueue writes an item to its spill file and reads it back. Provided for trivially
+// copyable types and BasicBytes; specialize it for other types with
+//   static auto size(T const & item) -> std::size_t;                   // bytes write() needs
+//   static auto write(T const & item, std::span<byte_t> out) -> void;  // out.size() == size(item)
+//   static auto read(std::span<byte_t const> in) -> T;
+template <typename T>
+struct SpillCodec;
+
+template <typename T, std::size_t Capacity, stdexec::scheduler Scheduler, QueueCardinality CardinalityV = QueueCardinality::Mpmc>
+class SpillQueue;
+
+}
+
+#endif // ABC_INCLUDE_ABC_ASYNC_SPILL_QUEUE_FWD_DECL
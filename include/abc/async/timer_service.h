@@ -0,0 +1,270 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_TIMER_SERVICE
+#define ABC_INCLUDE_ABC_ASYNC_TIMER_SERVICE
+
+#pragma once
+
+#include "timer_service_decl.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace abc::async
+{
+
+template <typename Clock>
+TimerService<Clock>::TimerService(duration const resolution)
+    : resolution_{ std::max(resolution, duration{ 1 }) }, origin_{ Clock::now() }, max_tick_{ static_cast<std::uint64_t>((time_point::max() - origin_) / resolution_) }
+{
+    thread_ = std::thread{ [this] { run(); } };
+}
+
+template <typename Clock>
+TimerService<Clock>::~TimerService()
+{
+    {
+        std::lock_guard lock{ mutex_ };
+        stopping_ = true;
+    }
+    wakeup_.notify_one();
+    thread_.join();
+}
+
+template <typename Clock>
+std::uint64_t
+TimerService<Clock>::deadline_tick(time_point const deadline) const noexcept
+{
+    if (deadline <= origin_)
+    {
+        return 0;
+    }
+
+    duration const elapsed = deadline - origin_;
+    auto const tick = static_cast<std::uint64_t>(elapsed / resolution_);
+    return elapsed % resolution_ == duration::zero() ? tick : tick + 1;
+}
+
+template <typename Clock>
+std::uint64_t
+TimerService<Clock>::tick_of(time_point const now) const noexcept
+{
+    return now <= origin_ ? 0 : static_cast<std::uint64_t>((now - origin_) / resolution_);
+}
+
+template <typename Clock>
+auto
+TimerService<Clock>::time_of(std::uint64_t const tick) const noexcept -> time_point
+{
+    return tick >= max_tick_ ? time_point::max() : origin_ + resolution_ * static_cast<typename duration::rep>(tick);
+}
+
+template <typename Clock>
+void
+TimerService<Clock>::submit(details::TimerNode * node, time_point const deadline)
+{
+    std::uint64_t const tick = deadline_tick(deadline);
+    bool notify = false;
+    {
+        std::lock_guard lock{ mutex_ };
+        if (node->stop_requested)
+        {
+            node->next = stopped_;
+            stopped_ = node;
+            notify = sleeping_until_ != 0;
+        }
+        else
+        {
+            wheel_.insert(node, tick);
+            notify = tick < sleeping_until_;
+        }
+    }
+
+    if (notify)
+    {
+        wakeup_.notify_one();
+    }
+}
+
+template <typename Clock>
+void
+TimerService<Clock>::cancel(details::TimerNode * node) noexcept
+{
+    bool notify = false;
+    {
+        std::lock_guard lock{ mutex_ };
+        if (node->linked())
+        {
+            wheel_.erase(node);
+            node->next = stopped_;
+            stopped_ = node;
+            notify = sleeping_until_ != 0;
+        }
+        else
+        {
+            // Either not queued yet, or already taken off the wheel to complete
+            node->stop_requested = true;
+        }
+    }
+
+    if (notify)
+    {
+        wakeup_.notify_one();
+    }
+}
+
+template <typename Clock>
+void
+TimerService<Clock>::complete_all(details::TimerNode * nodes, bool const stopped) noexcept
+{
+    while (nodes != nullptr)
+    {
+        // Completing may destroy the operation state the node lives in
+        auto * next = static_cast<details::TimerNode *>(nodes->next);
+        nodes->next = nullptr;
+        nodes->complete_fn(nodes, stopped);
+        nodes = next;
+    }
+}
+
+template <typename Clock>
+void
+TimerService<Clock>::run()
+{
+    // Never sleep longer than this, so that far deadlines need no representable wake-up time
+    constexpr auto max_sleep = std::chrono::hours{ 1 };
+
+    std::unique_lock lock{ mutex_ };
+    while (true)
+    {
+        details::TimerNode * stopped = std::exchange(stopped_, nullptr);
+
+        // Kept in expiry order
+        timing_wheel_node * expired_head = nullptr;
+        timing_wheel_node ** tail = &expired_head;
+        wheel_.advance(tick_of(Clock::now()), [&tail](timing_wheel_node * node) {
+            *tail = node;
+            tail = &node->next;
+        });
+        auto * expired = static_cast<details::TimerNode *>(expired_head);
+
+        if (stopped != nullptr || expired != nullptr)
+        {
+            lock.unlock();
+            complete_all(stopped, true);
+            complete_all(expired, false);
+            lock.lock();
+            continue;
+        }
+
+        if (stopping_)
+        {
+            break;
+        }
+
+        sleeping_until_ = wheel_.next_wakeup();
+        if (sleeping_until_ == std::numeric_limits<std::uint64_t>::max())
+        {
+            wakeup_.wait(lock);
+        }
+        else
+        {
+            wakeup_.wait_until(lock, std::min(time_of(sleeping_until_), Clock::now() + max_sleep));
+        }
+        sleeping_until_ = 0;
+    }
+
+    details::TimerNode * pending = nullptr;
+    wheel_.clear([&pending](timing_wheel_node * node) {
+        node->next = pending;
+        pending = static_cast<details::TimerNode *>(node);
+    });
+    lock.unlock();
+    complete_all(pending, true);
+}
+
+template <typename Clock>
+auto
+TimerService<Clock>::get_scheduler() noexcept -> TimerScheduler<Clock>
+{
+    return TimerScheduler<Clock>{ this };
+}
+
+template <typename Clock>
+auto
+TimerService<Clock>::resolution() const noexcept -> duration
+{
+    return resolution_;
+}
+
+template <typename Clock>
+TimerScheduler<Clock>::TimerScheduler(TimerService<Clock> * service) noexcept : service_{ service }
+{
+}
+
+template <typename Clock>
+auto
+TimerScheduler<Clock>::schedule() const noexcept -> sender_type
+{
+    return sender_type{ service_, details::TimerDeadline<Clock>::at(time_point::min()) };
+}
+
+template <typename Clock>
+auto
+TimerScheduler<Clock>::schedule_at(time_point const deadline) const noexcept -> sender_type
+{
+    return sender_type{ service_, details::TimerDeadline<Clock>::at(deadline) };
+}
+
+template <typename Clock>
+auto
+TimerScheduler<Clock>::schedule_after(duration const delay) const noexcept -> sender_type
+{
+    return sender_type{ service_, details::TimerDeadline<Clock>::after(delay) };
+}
+
+template <typename Clock>
+auto
+TimerScheduler<Clock>::now() const noexcept -> time_point
+{
+    return Clock::now();
+}
+
+template <typename Clock>
+auto
+schedule_at(TimerScheduler<Clock> scheduler, typename Clock::time_point const deadline) noexcept -> typename TimerScheduler<Clock>::sender_type
+{
+    return scheduler.schedule_at(deadline);
+}
+
+template <typename Clock>
+auto
+schedule_after(TimerScheduler<Clock> scheduler, typename Clock::duration const delay) noexcept -> typename TimerScheduler<Clock>::sender_type
+{
+    return scheduler.schedule_after(delay);
+}
+
+inline auto
+default_timer_service() -> TimerService<> &
+{
+    static TimerService<> service;
+    return service;
+}
+
+inline auto
+sleep_for(std::chrono::steady_clock::duration const delay) -> TimerScheduler<std::chrono::steady_clock>::sender_type
+{
+    return default_timer_service().get_scheduler().schedule_after(delay);
+}
+
+inline auto
+sleep_until(std::chrono::steady_clock::time_point const deadline) -> TimerScheduler<std::chrono::steady_clock>::sender_type
+{
+    return default_timer_service().get_scheduler().schedule_at(deadline);
+}
+
+} // namespace abc::async
+
+#endif // ABC_INCLUDE_ABC_ASYNC_TIMER_SERVICE
@@ -0,0 +1,132 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_TIMER_SERVICE_DECL
+#define ABC_INCLUDE_ABC_ASYNC_TIMER_SERVICE_DECL
+
+#pragma once
+
+#include "timer_service_fwd_decl.h"
+
+#include "abc/timing_wheel.h"
+#include "details/timer_senders.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace abc::async
+{
+
+// Timer run loop for the stdexec side of the library: a dedicated thread owning a timing_wheel,
+// handing out TimerScheduler, whose schedule_at() / schedule_after() senders complete on that
+// thread once their deadline has passed. Queue deadlines and timeouts thus stay on the stdexec
+// runtime, without an asio event loop next to it.
+//
+// Deadlines are rounded up to `resolution`, so that timers never complete early. Operation
+// states embed their wheel node: starting a timer allocates nothing and takes the service mutex
+// for an O(1) insert, and the thread is only woken when the new timer is due before the one it
+// sleeps for. Stop requests (from the receiver's stop token) unlink the node in O(1) and complete
+// the operation with set_stopped. Completions run on the service thread, so they should be short
+// or hop to another scheduler. Timers still pending when the service is destroyed complete with
+// set_stopped; no timer may be started after that.
+template <typename Clock>
+class TimerService
+{
+public:
+    using clock_type = Clock;
+    using time_point = typename Clock::time_point;
+    using duration = typename Clock::duration;
+
+private:
+    template <typename, typename>
+    friend class details::TimerOperation;
+
+    duration resolution_;
+    time_point origin_;
+
+    // Last tick time_of() can represent
+    std::uint64_t max_tick_;
+
+    std::mutex mutex_;
+    std::condition_variable wakeup_;
+    timing_wheel wheel_{};
+
+    // Nodes stopped while queued, completed with set_stopped by the service thread
+    details::TimerNode * stopped_{ nullptr };
+
+    // Tick the service thread sleeps until, 0 while it is awake and about to look at the wheel
+    // anyway, so that submitters only notify it when needed
+    std::uint64_t sleeping_until_{ 0 };
+    bool stopping_{ false };
+    std::thread thread_;
+
+    // First tick not before `deadline`, 0 for deadlines already past at construction
+    auto deadline_tick(time_point deadline) const noexcept -> std::uint64_t;
+    auto tick_of(time_point now) const noexcept -> std::uint64_t;
+    auto time_of(std::uint64_t tick) const noexcept -> time_point;
+
+    auto submit(details::TimerNode * node, time_point deadline) -> void;
+    auto cancel(details::TimerNode * node) noexcept -> void;
+
+    auto run() -> void;
+    static auto complete_all(details::TimerNode * nodes, bool stopped) noexcept -> void;
+
+public:
+    explicit TimerService(duration resolution = std::chrono::milliseconds{ 1 });
+
+    TimerService(TimerService const &) = delete;
+    auto operator=(TimerService const &) -> TimerService & = delete;
+    TimerService(TimerService &&) = delete;
+    auto operator=(TimerService &&) -> TimerService & = delete;
+    ~TimerService();
+
+    auto get_scheduler() noexcept -> TimerScheduler<Clock>;
+
+    auto resolution() const noexcept -> duration;
+};
+
+// stdexec scheduler of a TimerService. schedule() completes on the service thread as soon as
+// possible, schedule_at() / schedule_after() once the deadline has passed.
+template <typename Clock>
+class TimerScheduler
+{
+public:
+    using time_point = typename Clock::time_point;
+    using duration = typename Clock::duration;
+    using sender_type = details::TimerSender<TimerService<Clock>>;
+
+private:
+    TimerService<Clock> * service_;
+
+public:
+    explicit TimerScheduler(TimerService<Clock> * service) noexcept;
+
+    auto schedule() const noexcept -> sender_type;
+    auto schedule_at(time_point deadline) const noexcept -> sender_type;
+
+    // The delay counts from when the operation is started, not from when the sender is made
+    auto schedule_after(duration delay) const noexcept -> sender_type;
+
+    auto now() const noexcept -> time_point;
+
+    friend auto operator==(TimerScheduler const &, TimerScheduler const &) -> bool = default;
+};
+
+template <typename Clock>
+auto schedule_at(TimerScheduler<Clock> scheduler, typename Clock::time_point deadline) noexcept -> typename TimerScheduler<Clock>::sender_type;
+
+template <typename Clock>
+auto schedule_after(TimerScheduler<Clock> scheduler, typename Clock::duration delay) noexcept -> typename TimerScheduler<Clock>::sender_type;
+
+// Process-wide service behind sleep_for() / sleep_until(), started on first use
+auto default_timer_service() -> TimerService<> &;
+
+// `co_await sleep_for(...)` resumes on the default service thread after `delay`
+auto sleep_for(std::chrono::steady_clock::duration delay) -> TimerScheduler<std::chrono::steady_clock>::sender_type;
+auto sleep_until(std::chrono::steady_clock::time_point deadline) -> TimerScheduler<std::chrono::steady_clock>::sender_type;
+
+} // namespace abc::async
+
+#endif // ABC_INCLUDE_ABC_ASYNC_TIMER_SERVICE_DECL
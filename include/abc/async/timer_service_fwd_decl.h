@@ -0,0 +1,22 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_ASYNC_TIMER_SERVICE_FWD_DECL
+#define ABC_INCLUDE_ABC_ASYNC_TIMER_SERVICE_FWD_DECL
+
+#pragma once
+
+#include <chrono>
+
+namespace abc::async
+{
+
+template <typename Clock = std::chrono::steady_clock>
+class TimerService;
+
+template <typename Clock>
+class TimerScheduler;
+
+}
+
+#endif // ABC_INCLUDE_ABC_ASYNC_TIMER_SERVICE_FWD_DECL
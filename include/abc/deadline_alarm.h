@@ -0,0 +1,88 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & abc contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#if !defined(ABC_DEADLINE_ALARM)
+#define ABC_DEADLINE_ALARM
+
+#pragma once
+
+#include "abc/details/config.h"
+
+#include <asio/any_io_executor.hpp>
+
+#if defined(ABC_OS_LINUX)
+#include <asio/buffer.hpp>
+#include <asio/posix/stream_descriptor.hpp>
+#else
+#include <asio/steady_timer.hpp>
+#endif
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <utility>
+
+namespace abc {
+
+// One-shot wakeup at an absolute steady_clock time, waited for asynchronously on an executor.
+//
+// On Linux it is a timerfd on CLOCK_MONOTONIC (the clock behind std::chrono::steady_clock)
+// armed with an absolute expiry, so the kernel wakes the io_context at nanosecond resolution
+// without rounding the deadline to a relative timeout. Elsewhere it falls back to an
+// asio::steady_timer. Completion handlers run on the executor given at construction, with
+// asio::error::operation_aborted when cancel() got to them first.
+//
+// The timerfd is waited for by reading its expiration count, not by waiting for readiness: the
+// read is attempted right away, so an expiry already passed when async_wait() is called is
+// never missed, even when another thread of the io_context consumed the descriptor's
+// edge-triggered readiness before the wait was queued.
+class deadline_alarm {
+public:
+    using clock_type = std::chrono::steady_clock;
+
+private:
+#if defined(ABC_OS_LINUX)
+    asio::posix::stream_descriptor descriptor_;
+
+    // Expiration count read by a completed wait
+    std::uint64_t expirations_{ 0 };
+#else
+    asio::steady_timer timer_;
+#endif
+
+public:
+    deadline_alarm(deadline_alarm const &) = delete;
+    auto operator=(deadline_alarm const &) -> deadline_alarm & = delete;
+    deadline_alarm(deadline_alarm &&) = delete;
+    auto operator=(deadline_alarm &&) -> deadline_alarm & = delete;
+    ~deadline_alarm() = default;
+
+    // Throws abc_error carrying the system error code when the timer cannot be created
+    explicit deadline_alarm(asio::any_io_executor const & executor);
+
+    // Sets the expiry, replacing the previous one. A time already passed expires right away.
+    void expires_at(clock_type::time_point time);
+
+    // `handler(std::error_code const &)` runs once the expiry passes or cancel() is called
+    template <typename Handler>
+    void async_wait(Handler && handler);
+
+    void cancel();
+};
+
+template <typename Handler>
+void
+deadline_alarm::async_wait(Handler && handler) {
+#if defined(ABC_OS_LINUX)
+    descriptor_.async_read_some(asio::buffer(&expirations_, sizeof(expirations_)), [handler = std::forward<Handler>(handler)](std::error_code const & ec, std::size_t) mutable {
+        handler(ec);
+    });
+#else
+    timer_.async_wait(std::forward<Handler>(handler));
+#endif
+}
+
+}
+
+#endif //ABC_DEADLINE_ALARM
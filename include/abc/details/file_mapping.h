@@ -0,0 +1,57 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#ifndef ABC_INCLUDE_ABC_DETAILS_FILE_MAPPING
+#define ABC_INCLUDE_ABC_DETAILS_FILE_MAPPING
+
+#pragma once
+
+#include "abc/byte.h"
+#include "config.h"
+
+#include <cstddef>
+
+#if defined(ABC_OS_LINUX)
+
+namespace abc::details
+{
+
+// Owned file descriptor together with a read-write shared mapping of it, both released on
+// destruction. Backs SharedMemory and MappedFile. Failures throw abc_error carrying the system
+// error code.
+class FileMapping
+{
+private:
+    byte_t * data_{ nullptr };
+    std::size_t size_{ 0 };
+    int fd_{ -1 };
+
+public:
+    FileMapping() noexcept = default;
+
+    // Takes ownership of `fd`, nothing is mapped yet
+    explicit FileMapping(int fd) noexcept;
+
+    FileMapping(FileMapping const &) = delete;
+    auto operator=(FileMapping const &) -> FileMapping & = delete;
+    FileMapping(FileMapping && other) noexcept;
+    auto operator=(FileMapping && other) noexcept -> FileMapping &;
+    ~FileMapping();
+
+    // Sets the file size to `size` bytes, new bytes zero-filled
+    auto truncate(std::size_t size) -> void;
+
+    // Maps the first `size` bytes of the file, replacing the current mapping (0 unmaps).
+    // data() may move.
+    auto map(std::size_t size) -> void;
+
+    [[nodiscard]] auto data() const noexcept -> byte_t *;
+    [[nodiscard]] auto size() const noexcept -> std::size_t;
+    [[nodiscard]] auto fd() const noexcept -> int;
+};
+
+} // namespace abc::details
+
+#endif // ABC_OS_LINUX
+
+#endif // ABC_INCLUDE_ABC_DETAILS_FILE_MAPPING
@@ -54,6 +54,11 @@ enum class errc {
     not_supported_byte_order,
     view_built_from_rvalue,
     task_done_called_too_many_times,
+    invalid_queue_capacity,
+    consumer_added_after_publish,
+    message_too_large,
+    shared_memory_not_ready,
+    shared_memory_layout_mismatch,
 };
 
 auto make_error_code(errc ec) noexcept -> std::error_code;
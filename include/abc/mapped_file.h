@@ -0,0 +1,58 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#if !defined(ABC_INCLUDE_ABC_MAPPED_FILE)
+#define ABC_INCLUDE_ABC_MAPPED_FILE
+
+#pragma once
+
+#include "byte.h"
+#include "details/config.h"
+#include "details/file_mapping.h"
+
+#include <cstddef>
+#include <string>
+
+#if defined(ABC_OS_LINUX)
+
+namespace abc
+{
+
+// Read-write shared mapping of a whole file that can be resized. New bytes are zero-filled.
+// Failures throw abc_error carrying the system error code.
+class MappedFile
+{
+private:
+    details::FileMapping mapping_;
+
+    // Adopts a file already sized and mapped
+    explicit MappedFile(details::FileMapping mapping) noexcept;
+
+public:
+    MappedFile() noexcept = default;
+
+    MappedFile(MappedFile const &) = delete;
+    auto operator=(MappedFile const &) -> MappedFile & = delete;
+    MappedFile(MappedFile && other) noexcept = default;
+    auto operator=(MappedFile && other) noexcept -> MappedFile & = default;
+    ~MappedFile() = default;
+
+    // Creates (or truncates) the file at `path`
+    static auto create(std::string const & path, std::size_t size) -> MappedFile;
+
+    // Unnamed file in `directory`, removed by the system once unmapped and closed
+    static auto temporary(std::string const & directory, std::size_t size) -> MappedFile;
+
+    // Resizes the file and the mapping; data() may move, earlier pointers into it are invalidated
+    auto resize(std::size_t size) -> void;
+
+    [[nodiscard]] auto data() const noexcept -> byte_t *;
+    [[nodiscard]] auto size() const noexcept -> std::size_t;
+    [[nodiscard]] auto fd() const noexcept -> int;
+};
+
+} // namespace abc
+
+#endif // ABC_OS_LINUX
+
+#endif // ABC_INCLUDE_ABC_MAPPED_FILE
@@ -227,6 +227,18 @@ operator<=>(observer_ptr<T> lhs, observer_ptr<U> rhs) -> std::strong_ordering
     return static_cast<common_type>(lhs.get()) <=> static_cast<common_type>(rhs.get());
 }
 
+// Size of the huge pages `allocate_pages` aligns large allocations to
+constexpr std::size_t huge_page_size_in_bytes = std::size_t{ 2 } * 1024 * 1024;
+
+// Allocates `size` bytes of zero-filled memory directly from the OS. Pages are committed when
+// first touched, so the cost scales with the memory actually used. Allocations of at least one
+// huge page are aligned to it and, where supported, advised to be backed by huge pages.
+// Throws std::bad_alloc on failure.
+auto allocate_pages(std::size_t size) -> void *;
+
+// Releases memory obtained from `allocate_pages(size)`.
+auto deallocate_pages(void * pages, std::size_t size) noexcept -> void;
+
 } // namespace abc
 
 namespace std
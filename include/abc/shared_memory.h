@@ -0,0 +1,64 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#if !defined(ABC_INCLUDE_ABC_SHARED_MEMORY)
+#define ABC_INCLUDE_ABC_SHARED_MEMORY
+
+#pragma once
+
+#include "byte.h"
+#include "details/config.h"
+#include "details/file_mapping.h"
+
+#include <cstddef>
+#include <string>
+
+#if defined(ABC_OS_LINUX)
+
+namespace abc
+{
+
+// Read-write mapping of memory shared between processes: either a named POSIX shared memory
+// object, or an anonymous one (memfd) that child processes inherit across fork(). Newly created
+// bytes are zero-filled. The mapping is released with the object; a named object lives on until
+// unlink(). Failures throw abc_error carrying the system error code.
+class SharedMemory
+{
+private:
+    details::FileMapping mapping_;
+
+    // Adopts an object already sized and mapped
+    explicit SharedMemory(details::FileMapping mapping) noexcept;
+
+public:
+    SharedMemory() noexcept = default;
+
+    SharedMemory(SharedMemory const &) = delete;
+    auto operator=(SharedMemory const &) -> SharedMemory & = delete;
+    SharedMemory(SharedMemory && other) noexcept = default;
+    auto operator=(SharedMemory && other) noexcept -> SharedMemory & = default;
+    ~SharedMemory() = default;
+
+    // Opens the object called `name` (e.g. "/my_queue"), creating it when missing, and sizes it
+    // to `size` bytes. Contents of an existing object are kept up to the new size.
+    static auto create(std::string const & name, std::size_t size) -> SharedMemory;
+
+    // Opens an existing object and maps all of it
+    static auto open(std::string const & name) -> SharedMemory;
+
+    // Unnamed object of `size` bytes, shared with processes forked after this call
+    static auto anonymous(std::size_t size) -> SharedMemory;
+
+    // Removes the name; processes that already mapped the object keep it
+    static auto unlink(std::string const & name) -> void;
+
+    [[nodiscard]] auto data() const noexcept -> byte_t *;
+    [[nodiscard]] auto size() const noexcept -> std::size_t;
+    [[nodiscard]] auto fd() const noexcept -> int;
+};
+
+} // namespace abc
+
+#endif // ABC_OS_LINUX
+
+#endif // ABC_INCLUDE_ABC_SHARED_MEMORY
@@ -31,7 +31,7 @@ public:
     auto operator=(timer && other) -> timer & = delete;
     ~timer() noexcept;
 
-    explicit timer(asio::io_context * io_object, std::chrono::milliseconds const & ms_in_future, timeout_callback_t callback);
+    explicit timer(asio::io_context * io_object, std::chrono::nanoseconds const & in_future, timeout_callback_t callback);
 
     auto expired() const noexcept -> bool;
     auto wait() -> std::expected<void, std::error_code>;
@@ -6,25 +6,216 @@
 
 #pragma once
 
+#include "abc/deadline_alarm.h"
 #include "abc/timer.h"
+#include "abc/timing_wheel.h"
 
 #include <asio/io_context.hpp>
+#include <asio/strand.hpp>
 
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
 #include <mutex>
-#include <vector>
 #include <memory>
+#include <system_error>
+#include <vector>
 
 namespace abc {
 
-class timer_driver : std::enable_shared_from_this<timer_driver> {
+// Refers to a timer scheduled on a timer_driver: the slot of its entry and the generation the
+// entry had when scheduled. Entries are reused, so a handle goes stale once its timer fired or
+// was cancelled, and the driver then ignores it. A default-constructed handle refers to nothing.
+struct timer_handle {
+    static constexpr std::uint32_t invalid_slot = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t slot{invalid_slot};
+    std::uint32_t generation{0};
+
+    explicit operator bool() const noexcept {
+        return slot != invalid_slot;
+    }
+
+    friend auto operator==(timer_handle const &, timer_handle const &) -> bool = default;
+};
+
+// How a periodic timer picks its next expiry
+enum class timer_mode : std::uint8_t {
+    // Every `period` after the first expiry, however long the callbacks take
+    fixed_rate,
+    // `period` after the previous callback returned
+    fixed_delay,
+};
+
+// What a fixed-rate timer does about periods that passed while the driver could not fire it
+enum class catch_up_policy : std::uint8_t {
+    // Fire once for every missed period, back to back
+    fire_all,
+    // Fire once, then carry on with the next period of the original schedule
+    skip,
+    // Fire once, then start counting periods afresh from now
+    realign,
+};
+
+// Runs many timeouts off a single deadline_alarm (a timerfd on Linux). Scheduled callbacks are
+// kept in a timing_wheel whose tick is `resolution` long, one microsecond by default. Each reap
+// advances the wheel to the current time and invokes the expired callbacks, with a default
+// error_code, on the io_context. The alarm is armed for the wheel's next wakeup, but at most
+// `reap_interval` ahead; scheduling an earlier deadline wakes it up sooner. stop() wakes it up
+// too, and that reap invokes the callbacks still pending with asio::error::operation_aborted.
+//
+// A timer given some slack may fire anywhere in [deadline, deadline + slack]; its expiry is
+// moved to the roundest tick of that window (timing_wheel::coalesce), so that timers with
+// overlapping windows share an expiry and a single wakeup fires them all.
+//
+// Only the reap chain touches the wheel. Other threads never lock: schedule() takes a pooled
+// entry off a lock-free free list, and schedule(), cancel() and reschedule() publish their change
+// in the entry's control word and push the entry onto an intrusive MPSC inbox, which every reap
+// drains in one batch before advancing the wheel. Cancelling or moving a timer is O(1), and a
+// cancelled entry is recycled by the next reap.
+//
+// Periodic timers keep their entry, handle and callback from one firing to the next, so that
+// a firing allocates nothing; they run until cancelled or stopped.
+class timer_driver : public std::enable_shared_from_this<timer_driver> {
 private:
+    using clock_type = std::chrono::steady_clock;
+
+    enum class entry_status : std::uint32_t {
+        free,
+        armed,
+        // A reschedule() is writing the new expiry; the entry is back to armed right after
+        rescheduling,
+        cancelled,
+        // The reap chain is invoking a periodic timer's callback; the entry is back to armed, or
+        // cancelled by that callback, when it returns
+        firing,
+    };
+
+    struct entry : timing_wheel_node {
+        // Written by schedule() before arming, then owned by the reap chain
+        timer::timeout_callback_t callback;
+
+        // Generation in the upper half, entry_status in the lower one. Retiring an entry bumps
+        // its generation, which invalidates the handles given out for it.
+        std::atomic<std::uint64_t> control{0};
+        std::atomic<std::uint64_t> requested_expiry{0};
+
+        // Deadline before coalescing, for the wakeups_avoided() count; `deadline` is the copy
+        // owned by the reap chain
+        std::atomic<std::uint64_t> requested_deadline{0};
+        std::uint64_t deadline{0};
+
+        // Set while the entry sits in the inbox, so that it is pushed at most once
+        std::atomic<bool> queued{false};
+        entry * next_queued{nullptr};
+
+        std::atomic<std::uint32_t> next_free{timer_handle::invalid_slot};
+        std::uint32_t slot{0};
+
+        // Written by schedule() before arming; a zero period makes a one-shot timer
+        std::uint64_t period{0};
+        timer_mode mode{timer_mode::fixed_rate};
+        catch_up_policy catch_up{catch_up_policy::skip};
+    };
+
+    // Entries live in chunks that never move, chunk k holding first_chunk_size << k of them
+    static constexpr std::uint32_t first_chunk_size = 256;
+    static constexpr std::size_t max_chunks = 24;
+
     std::atomic<bool> running_{false};
-    mutable std::mutex timers_mutex_;
-    std::vector<std::unique_ptr<timer>> timers_{};
 
-    std::chrono::milliseconds reap_interval_;
-    asio::io_context * io_context_;
+    // Set while a reap chain is alive, so that a quick stop() and start() do not fork a second one
+    std::atomic<bool> reaping_{false};
+
+    std::array<std::unique_ptr<entry[]>, max_chunks> chunks_{};
+    std::atomic<std::uint32_t> allocated_slots_{0};
+    std::mutex grow_mutex_;
+
+    // Treiber stack of free slots: an ABA tag in the upper half, the top slot in the lower one
+    std::atomic<std::uint64_t> free_slots_{timer_handle::invalid_slot};
+
+    std::atomic<entry *> inbox_{nullptr};
+    std::atomic<std::size_t> pending_{0};
+
+    // Owned by the reap chain
+    timing_wheel wheel_{};
+    std::vector<std::uint64_t> fired_deadlines_{};
+
+    // Tick the reap timer is armed for, 0 while the chain is awake and bound to drain the inbox
+    // again before sleeping. An earlier deadline posts a wake-up, at most one at a time.
+    std::atomic<std::uint64_t> armed_tick_{0};
+    std::atomic<bool> wake_pending_{false};
+
+    std::atomic<std::uint64_t> wakeups_{0};
+    std::atomic<std::uint64_t> wakeups_avoided_{0};
+
+    clock_type::time_point epoch_{clock_type::now()};
+    std::chrono::nanoseconds reap_interval_;
+    std::chrono::nanoseconds resolution_;
+
+    // Serializes the reap chain and wake-ups, even on an io_context run by several threads
+    asio::strand<asio::io_context::executor_type> strand_;
+    deadline_alarm reap_alarm_;
+
+    static constexpr auto control_of(std::uint32_t generation, entry_status status) noexcept -> std::uint64_t {
+        return (std::uint64_t{generation} << 32) | static_cast<std::uint32_t>(status);
+    }
+
+    static constexpr auto generation_of(std::uint64_t control) noexcept -> std::uint32_t {
+        return static_cast<std::uint32_t>(control >> 32);
+    }
+
+    static constexpr auto status_of(std::uint64_t control) noexcept -> entry_status {
+        return static_cast<entry_status>(static_cast<std::uint32_t>(control));
+    }
+
+    // Wheel tick (elapsed resolution_ periods since epoch_) containing `time`
+    auto tick_of(clock_type::time_point time) const noexcept -> std::uint64_t;
+
+    // Start of wheel tick `tick`
+    auto time_of(std::uint64_t tick) const noexcept -> clock_type::time_point;
+
+    // Deadline tick of a timer scheduled now to fire `in_future`
+    auto deadline_of(std::chrono::nanoseconds const & in_future) const -> std::uint64_t;
+
+    // Whole ticks in `slack`, so that coalescing never fires a timer more than `slack` late
+    auto slack_ticks(std::chrono::nanoseconds const & slack) const noexcept -> std::uint64_t;
+
+    auto entry_at(std::uint32_t slot) const noexcept -> entry &;
+
+    // Takes a free slot, growing the pool when there is none
+    auto acquire_slot() -> std::uint32_t;
+    void release_slot(entry & e) noexcept;
+    void grow();
+
+    // Moves the entry `handle` refers to from armed to `next`, waiting out a concurrent
+    // reschedule(), and a running periodic callback unless called from that callback. Returns
+    // nullptr when `handle` is stale.
+    auto claim(timer_handle handle, entry_status next) noexcept -> entry *;
+
+    auto arm(std::uint64_t deadline, std::uint64_t expiry, timer::timeout_callback_t callback, std::uint64_t period, timer_mode mode, catch_up_policy catch_up) -> timer_handle;
+
+    // Wakes the reap chain when `expiry` comes before the tick it sleeps for
+    void wake_for(std::uint64_t expiry);
+
+    // Posts a wake-up cancelling the reap alarm, unless one is pending already
+    void wake_up();
+
+    void enqueue(entry & e) noexcept;
+
+    // Reap chain only
+    void drain_inbox();
+    void reconcile(entry & e);
+    void retire(entry & e, std::uint64_t control) noexcept;
+    void fire(entry & e, std::error_code const & ec);
+    void fire_periodic(entry & e, std::uint64_t now);
+    auto next_expiry(entry const & e, std::uint64_t now) const noexcept -> std::uint64_t;
+    void abort_pending();
+
+    // Counts the distinct deadlines among the timers fired by one reap that slack merged away
+    void count_coalesced(std::uint64_t distinct_expiries);
 
 public:
     timer_driver(timer_driver const &) = delete;
@@ -33,7 +224,10 @@ public:
     auto operator=(timer_driver &&) -> timer_driver & = delete;
     ~timer_driver() = default;
 
-    explicit timer_driver(asio::io_context * io_context, std::chrono::milliseconds reap_interval_ms = std::chrono::milliseconds{100});
+    // Throws abc_error when the reap alarm cannot be created
+    explicit timer_driver(asio::io_context * io_context,
+                          std::chrono::nanoseconds reap_interval = std::chrono::milliseconds{100},
+                          std::chrono::nanoseconds resolution = std::chrono::microseconds{1});
 
     auto running() const noexcept -> bool;
     void running(bool r);
@@ -41,7 +235,44 @@ public:
     void start();
     void stop();
 
-    void schedule(std::chrono::milliseconds const & ms_in_future, timer::timeout_callback_t callback);
+    // Returns a default-constructed handle, without scheduling anything, when not running. The
+    // callback runs up to `slack` after the deadline, on an expiry shared with other timers.
+    auto schedule(std::chrono::nanoseconds const & in_future,
+                  timer::timeout_callback_t callback,
+                  std::chrono::nanoseconds const & slack = std::chrono::nanoseconds{0}) -> timer_handle;
+
+    // Invokes `callback` with a default error_code every `period` (at least one tick), the
+    // first time one period from now. The handle stays valid until cancel() or stop().
+    auto schedule_periodic(std::chrono::nanoseconds const & period,
+                           timer::timeout_callback_t callback,
+                           timer_mode mode = timer_mode::fixed_rate,
+                           catch_up_policy catch_up = catch_up_policy::skip) -> timer_handle;
+
+    // Cancels a pending timer in O(1): its callback is never invoked, and is destroyed by the
+    // next reap. Returns false when `handle` is stale: the timer already fired or was cancelled.
+    // While a periodic timer's callback runs, cancel() from another thread waits for it to return;
+    // called from the callback itself, it returns at once and the callback is not invoked again.
+    auto cancel(timer_handle handle) -> bool;
+
+    // Moves a pending timer to fire `in_future` from now, in O(1). The handle stays valid; a
+    // periodic timer keeps its period and counts it from the new expiry.
+    // Returns false when `handle` is stale. A timer expiring while this call runs may still fire
+    // at its old deadline. Waits out a running periodic callback the way cancel() does.
+    auto reschedule(timer_handle handle,
+                    std::chrono::nanoseconds const & in_future,
+                    std::chrono::nanoseconds const & slack = std::chrono::nanoseconds{0}) -> bool;
+
+    // Number of scheduled callbacks neither invoked nor cancelled
+    auto pending() const noexcept -> std::size_t;
+
+    auto resolution() const noexcept -> std::chrono::nanoseconds;
+
+    // Reaps run so far
+    auto wakeups() const noexcept -> std::uint64_t;
+
+    // Wakeups that slack saved: over every reap, the distinct deadline ticks of the fired timers
+    // minus the distinct ticks they actually expired at
+    auto wakeups_avoided() const noexcept -> std::uint64_t;
 
 private:
     void do_reap();
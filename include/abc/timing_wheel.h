@@ -0,0 +1,145 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & abc contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#if !defined(ABC_TIMING_WHEEL)
+#define ABC_TIMING_WHEEL
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace abc {
+
+// Intrusive hook for a timer in a timing_wheel. The owner embeds (or derives from) it and keeps
+// it alive while it is linked.
+struct timing_wheel_node {
+    timing_wheel_node * prev{nullptr};
+    timing_wheel_node * next{nullptr};
+    std::uint64_t expiry{0};
+    std::uint16_t bucket{unlinked};
+
+    static constexpr std::uint16_t unlinked = std::numeric_limits<std::uint16_t>::max();
+
+    auto linked() const noexcept -> bool {
+        return bucket != unlinked;
+    }
+};
+
+// Hierarchical timing wheel over abstract ticks, single-threaded.
+//
+// Level L has 64 buckets, each covering 64^L ticks. A node lives on the level of the highest
+// base-64 digit in which its expiry differs from the current tick, in the bucket of that digit.
+// When the current tick reaches a bucket it is cascaded: its nodes move to lower levels, at
+// most once per level over a node's lifetime. Insert and erase are O(1), expiry is amortized
+// O(1) per node, and advancing skips empty stretches through per-level occupancy bitmaps, so
+// the cost does not depend on how many ticks pass.
+class timing_wheel {
+public:
+    static constexpr std::size_t level_bits = 6;
+    static constexpr std::size_t slots_per_level = std::size_t{1} << level_bits;
+    static constexpr std::size_t level_count = (64 + level_bits - 1) / level_bits;
+
+private:
+    std::array<timing_wheel_node *, level_count * slots_per_level> buckets_{};
+    std::array<std::uint64_t, level_count> occupied_{};
+    std::uint64_t now_;
+    std::size_t size_{0};
+
+    static auto digit(std::uint64_t tick, std::size_t level) noexcept -> std::size_t;
+
+    auto link(timing_wheel_node * node) noexcept -> void;
+    auto unlink(timing_wheel_node * node) noexcept -> void;
+
+    // Re-files every node of the current bucket of `level` relative to now_
+    auto cascade(std::size_t level) noexcept -> void;
+
+    // Takes one node off the current level-0 bucket, nullptr when it is empty
+    auto pop_due() noexcept -> timing_wheel_node *;
+
+public:
+    timing_wheel(timing_wheel const &) = delete;
+    auto operator=(timing_wheel const &) -> timing_wheel & = delete;
+    timing_wheel(timing_wheel &&) = delete;
+    auto operator=(timing_wheel &&) -> timing_wheel & = delete;
+    ~timing_wheel() = default;
+
+    explicit timing_wheel(std::uint64_t now = 0) noexcept;
+
+    // Latest tick in [deadline, deadline + slack] with the most trailing zero bits. Timers whose
+    // windows overlap thus tend to share an expiry tick, and fire in one advance() step.
+    static auto coalesce(std::uint64_t deadline, std::uint64_t slack) noexcept -> std::uint64_t;
+
+    // Links `node` to expire at tick `expiry`. An expiry not after now() is due right away: it
+    // fires on the next advance(), or later in the current one when inserted from its callback.
+    auto insert(timing_wheel_node * node, std::uint64_t expiry) noexcept -> void;
+
+    // Unlinks a linked `node` without firing it
+    auto erase(timing_wheel_node * node) noexcept -> void;
+
+    // Moves the current tick forward to `target` and hands every node expiring on the way to
+    // `on_expired(timing_wheel_node *)`, unlinked and in expiry order. The callback may insert
+    // and erase nodes, including the one it was given. Returns the number of expired nodes.
+    template <typename OnExpired>
+    auto advance(std::uint64_t target, OnExpired && on_expired) -> std::size_t;
+
+    // Unlinks every node without moving the current tick, handing each to `on_removed(timing_wheel_node *)`
+    template <typename OnRemoved>
+    auto clear(OnRemoved && on_removed) -> std::size_t;
+
+    // Earliest tick at which advance() has work to do: the expiry of the first node, or a
+    // cascade before it. Never later than the first expiry; max() when the wheel is empty.
+    auto next_wakeup() const noexcept -> std::uint64_t;
+
+    auto now() const noexcept -> std::uint64_t;
+    auto size() const noexcept -> std::size_t;
+    auto empty() const noexcept -> bool;
+};
+
+template <typename OnExpired>
+auto
+timing_wheel::advance(std::uint64_t const target, OnExpired && on_expired) -> std::size_t {
+    std::size_t expired = 0;
+    while (true) {
+        while (timing_wheel_node * node = pop_due()) {
+            on_expired(node);
+            ++expired;
+        }
+
+        if (now_ >= target) {
+            return expired;
+        }
+
+        std::uint64_t const wakeup = next_wakeup();
+        std::uint64_t const next = wakeup < target ? wakeup : target;
+        std::uint64_t const changed = now_ ^ next;
+        now_ = next;
+
+        // Higher levels first, so that nodes cascade all the way down within this step
+        for (std::size_t level = level_count - 1; level > 0; --level) {
+            if ((changed >> (level * level_bits)) != 0) {
+                cascade(level);
+            }
+        }
+    }
+}
+
+template <typename OnRemoved>
+auto
+timing_wheel::clear(OnRemoved && on_removed) -> std::size_t {
+    std::size_t removed = 0;
+    for (std::size_t bucket = 0; bucket != buckets_.size(); ++bucket) {
+        while (timing_wheel_node * node = buckets_[bucket]) {
+            erase(node);
+            on_removed(node);
+            ++removed;
+        }
+    }
+    return removed;
+}
+
+}
+
+#endif //ABC_TIMING_WHEEL
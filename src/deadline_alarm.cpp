@@ -0,0 +1,73 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & abc contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <abc/deadline_alarm.h>
+
+#if defined(ABC_OS_LINUX)
+
+#include <abc/error.h>
+
+#include <algorithm>
+#include <cerrno>
+
+#include <sys/timerfd.h>
+
+namespace abc {
+
+namespace {
+
+auto
+create_timerfd() -> int {
+    int const fd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (fd < 0) {
+        throw_error(std::error_code{ errno, std::system_category() }, "timerfd_create");
+    }
+    return fd;
+}
+
+}
+
+deadline_alarm::deadline_alarm(asio::any_io_executor const & executor) : descriptor_{ executor, create_timerfd() } {
+}
+
+void
+deadline_alarm::expires_at(clock_type::time_point const time) {
+    // An all-zero it_value disarms the timer, so the earliest expiry is the first nanosecond
+    auto const since_boot = std::max(std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()), std::chrono::nanoseconds{1});
+    auto const seconds = std::chrono::floor<std::chrono::seconds>(since_boot);
+
+    itimerspec spec{};
+    spec.it_value.tv_sec = static_cast<time_t>(seconds.count());
+    spec.it_value.tv_nsec = static_cast<long>((since_boot - seconds).count());
+    if (::timerfd_settime(descriptor_.native_handle(), TFD_TIMER_ABSTIME, &spec, nullptr) != 0) {
+        throw_error(std::error_code{ errno, std::system_category() }, "timerfd_settime");
+    }
+}
+
+void
+deadline_alarm::cancel() {
+    descriptor_.cancel();
+}
+
+}
+
+#else
+
+namespace abc {
+
+deadline_alarm::deadline_alarm(asio::any_io_executor const & executor) : timer_{ executor } {
+}
+
+void
+deadline_alarm::expires_at(clock_type::time_point const time) {
+    timer_.expires_at(time);
+}
+
+void
+deadline_alarm::cancel() {
+    timer_.cancel();
+}
+
+}
+
+#endif // ABC_OS_LINUX
@@ -136,6 +136,21 @@ abc_category() noexcept -> std::error_category const &
                 case errc::task_done_called_too_many_times:
                     return "task done called too many times";
 
+                case errc::invalid_queue_capacity:
+                    return "queue capacity must be a power of 2";
+
+                case errc::consumer_added_after_publish:
+                    return "consumers must be added before the first publish";
+
+                case errc::message_too_large:
+                    return "message exceeds the maximum message size";
+
+                case errc::shared_memory_not_ready:
+                    return "shared memory segment is not initialized";
+
+                case errc::shared_memory_layout_mismatch:
+                    return "shared memory segment layout does not match";
+
                 default:
                     assert(false);
                     return "unknown error";
@@ -0,0 +1,105 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <abc/details/config.h>
+#include <abc/details/file_mapping.h>
+
+#if defined(ABC_OS_LINUX)
+
+#include <abc/error.h>
+
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace abc::details
+{
+
+FileMapping::FileMapping(int const fd) noexcept : fd_{ fd }
+{
+}
+
+FileMapping::FileMapping(FileMapping && other) noexcept
+    : data_{ std::exchange(other.data_, nullptr) }, size_{ std::exchange(other.size_, 0) }, fd_{ std::exchange(other.fd_, -1) }
+{
+}
+
+auto
+FileMapping::operator=(FileMapping && other) noexcept -> FileMapping &
+{
+    if (this != &other)
+    {
+        FileMapping released{ std::move(*this) };
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        fd_ = std::exchange(other.fd_, -1);
+    }
+    return *this;
+}
+
+FileMapping::~FileMapping()
+{
+    if (data_ != nullptr)
+    {
+        ::munmap(data_, size_);
+    }
+    if (fd_ != -1)
+    {
+        ::close(fd_);
+    }
+}
+
+auto
+FileMapping::truncate(std::size_t const size) -> void
+{
+    if (::ftruncate(fd_, static_cast<off_t>(size)) == -1)
+    {
+        throw_error(std::error_code{ errno, std::system_category() }, "ftruncate");
+    }
+}
+
+auto
+FileMapping::map(std::size_t const size) -> void
+{
+    void * data = nullptr;
+    if (size != 0)
+    {
+        data = data_ == nullptr ? ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0) : ::mremap(data_, size_, size, MREMAP_MAYMOVE);
+        if (data == MAP_FAILED)
+        {
+            throw_error(std::error_code{ errno, std::system_category() }, "mmap");
+        }
+    }
+    else if (data_ != nullptr)
+    {
+        ::munmap(data_, size_);
+    }
+
+    data_ = static_cast<byte_t *>(data);
+    size_ = size;
+}
+
+auto
+FileMapping::data() const noexcept -> byte_t *
+{
+    return data_;
+}
+
+auto
+FileMapping::size() const noexcept -> std::size_t
+{
+    return size_;
+}
+
+auto
+FileMapping::fd() const noexcept -> int
+{
+    return fd_;
+}
+
+} // namespace abc::details
+
+#endif // ABC_OS_LINUX
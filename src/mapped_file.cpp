@@ -0,0 +1,79 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <abc/details/config.h>
+#include <abc/mapped_file.h>
+
+#if defined(ABC_OS_LINUX)
+
+#include <abc/error.h>
+
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+
+namespace abc
+{
+
+MappedFile::MappedFile(details::FileMapping mapping) noexcept : mapping_{ std::move(mapping) }
+{
+}
+
+auto
+MappedFile::create(std::string const & path, std::size_t const size) -> MappedFile
+{
+    int const fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    if (fd == -1)
+    {
+        throw_error(std::error_code{ errno, std::system_category() }, "open");
+    }
+
+    MappedFile file{ details::FileMapping{ fd } };
+    file.resize(size);
+    return file;
+}
+
+auto
+MappedFile::temporary(std::string const & directory, std::size_t const size) -> MappedFile
+{
+    int const fd = ::open(directory.c_str(), O_RDWR | O_TMPFILE | O_CLOEXEC, 0600);
+    if (fd == -1)
+    {
+        throw_error(std::error_code{ errno, std::system_category() }, "open");
+    }
+
+    MappedFile file{ details::FileMapping{ fd } };
+    file.resize(size);
+    return file;
+}
+
+auto
+MappedFile::resize(std::size_t const size) -> void
+{
+    mapping_.truncate(size);
+    mapping_.map(size);
+}
+
+auto
+MappedFile::data() const noexcept -> byte_t *
+{
+    return mapping_.data();
+}
+
+auto
+MappedFile::size() const noexcept -> std::size_t
+{
+    return mapping_.size();
+}
+
+auto
+MappedFile::fd() const noexcept -> int
+{
+    return mapping_.fd();
+}
+
+} // namespace abc
+
+#endif // ABC_OS_LINUX
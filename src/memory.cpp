@@ -0,0 +1,86 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <abc/details/config.h>
+#include <abc/memory.h>
+
+#include <new>
+
+#if defined(ABC_OS_WINDOWS)
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace abc
+{
+
+auto
+allocate_pages(std::size_t const size) -> void *
+{
+    if (size == 0)
+    {
+        return nullptr;
+    }
+
+#if defined(ABC_OS_WINDOWS)
+    void * pages = ::VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    if (pages == nullptr)
+    {
+        throw std::bad_alloc{};
+    }
+    return pages;
+#else
+    if (size < huge_page_size_in_bytes)
+    {
+        void * pages = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (pages == MAP_FAILED)
+        {
+            throw std::bad_alloc{};
+        }
+        return pages;
+    }
+
+    // Over-map by one huge page and trim both ends, leaving a huge-page-aligned range
+    std::size_t const length = aligned_size<huge_page_size_in_bytes>(size);
+    void * raw = ::mmap(nullptr, length + huge_page_size_in_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED)
+    {
+        throw std::bad_alloc{};
+    }
+
+    byte_t * first = static_cast<byte_t *>(raw);
+    byte_t * aligned = address_aligned_at<huge_page_size_in_bytes>(first);
+    if (aligned != first)
+    {
+        ::munmap(first, static_cast<std::size_t>(aligned - first));
+    }
+    if (std::size_t const tail = huge_page_size_in_bytes - static_cast<std::size_t>(aligned - first); tail != 0)
+    {
+        ::munmap(aligned + length, tail);
+    }
+
+#if defined(MADV_HUGEPAGE)
+    // Advisory only; ignore failures (e.g. transparent huge pages disabled)
+    ::madvise(aligned, length, MADV_HUGEPAGE);
+#endif
+    return aligned;
+#endif
+}
+
+auto
+deallocate_pages(void * pages, std::size_t const size) noexcept -> void
+{
+    if (pages == nullptr)
+    {
+        return;
+    }
+
+#if defined(ABC_OS_WINDOWS)
+    ::VirtualFree(pages, 0, MEM_RELEASE);
+#else
+    ::munmap(pages, size < huge_page_size_in_bytes ? size : aligned_size<huge_page_size_in_bytes>(size));
+#endif
+}
+
+} // namespace abc
@@ -0,0 +1,104 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <abc/details/config.h>
+#include <abc/shared_memory.h>
+
+#if defined(ABC_OS_LINUX)
+
+#include <abc/error.h>
+
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace abc
+{
+
+SharedMemory::SharedMemory(details::FileMapping mapping) noexcept : mapping_{ std::move(mapping) }
+{
+}
+
+auto
+SharedMemory::create(std::string const & name, std::size_t const size) -> SharedMemory
+{
+    int const fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+    if (fd == -1)
+    {
+        throw_error(std::error_code{ errno, std::system_category() }, "shm_open");
+    }
+
+    details::FileMapping mapping{ fd };
+    mapping.truncate(size);
+    mapping.map(size);
+    return SharedMemory{ std::move(mapping) };
+}
+
+auto
+SharedMemory::open(std::string const & name) -> SharedMemory
+{
+    int const fd = ::shm_open(name.c_str(), O_RDWR, 0);
+    if (fd == -1)
+    {
+        throw_error(std::error_code{ errno, std::system_category() }, "shm_open");
+    }
+
+    details::FileMapping mapping{ fd };
+    struct stat status{};
+    if (::fstat(fd, &status) == -1)
+    {
+        throw_error(std::error_code{ errno, std::system_category() }, "fstat");
+    }
+    mapping.map(static_cast<std::size_t>(status.st_size));
+    return SharedMemory{ std::move(mapping) };
+}
+
+auto
+SharedMemory::anonymous(std::size_t const size) -> SharedMemory
+{
+    int const fd = ::memfd_create("abc_shared_memory", MFD_CLOEXEC);
+    if (fd == -1)
+    {
+        throw_error(std::error_code{ errno, std::system_category() }, "memfd_create");
+    }
+
+    details::FileMapping mapping{ fd };
+    mapping.truncate(size);
+    mapping.map(size);
+    return SharedMemory{ std::move(mapping) };
+}
+
+auto
+SharedMemory::unlink(std::string const & name) -> void
+{
+    if (::shm_unlink(name.c_str()) == -1)
+    {
+        throw_error(std::error_code{ errno, std::system_category() }, "shm_unlink");
+    }
+}
+
+auto
+SharedMemory::data() const noexcept -> byte_t *
+{
+    return mapping_.data();
+}
+
+auto
+SharedMemory::size() const noexcept -> std::size_t
+{
+    return mapping_.size();
+}
+
+auto
+SharedMemory::fd() const noexcept -> int
+{
+    return mapping_.fd();
+}
+
+} // namespace abc
+
+#endif // ABC_OS_LINUX
@@ -5,7 +5,8 @@
 
 namespace abc {
 
-timer::timer(asio::io_context * io_context, std::chrono::milliseconds const & ms_in_future, timeout_callback_t callback) : timer_{ io_context->get_executor(), ms_in_future } {
+timer::timer(asio::io_context * io_context, std::chrono::nanoseconds const & in_future, timeout_callback_t callback)
+    : timer_{ io_context->get_executor(), std::chrono::duration_cast<asio::steady_timer::duration>(in_future) } {
     timer_.async_wait(std::move(callback));
 }
 
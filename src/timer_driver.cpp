@@ -3,11 +3,293 @@
 
 #include <abc/timer_driver.h>
 
+#include <asio/error.hpp>
+#include <asio/post.hpp>
+
+#include <algorithm>
+#include <bit>
 #include <cassert>
+#include <limits>
+#include <new>
+#include <thread>
 
 namespace abc {
 
-timer_driver::timer_driver(asio::io_context * io_context, std::chrono::milliseconds reap_interval) : reap_interval_{ reap_interval }, io_context_{ io_context } {
+timer_driver::timer_driver(asio::io_context * io_context, std::chrono::nanoseconds const reap_interval, std::chrono::nanoseconds const resolution)
+    : reap_interval_{ reap_interval }
+    , resolution_{ std::max(resolution, std::chrono::nanoseconds{1}) }
+    , strand_{ asio::make_strand(*io_context) }
+    , reap_alarm_{ strand_ } {
+}
+
+auto
+timer_driver::tick_of(clock_type::time_point const time) const noexcept -> std::uint64_t {
+    return static_cast<std::uint64_t>((time - epoch_) / resolution_);
+}
+
+auto
+timer_driver::time_of(std::uint64_t const tick) const noexcept -> clock_type::time_point {
+    return epoch_ + std::chrono::duration_cast<clock_type::duration>(resolution_ * static_cast<std::int64_t>(tick));
+}
+
+auto
+timer_driver::deadline_of(std::chrono::nanoseconds const & in_future) const -> std::uint64_t {
+    // Rounded up, a timer may fire up to one tick late but never early
+    auto const elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - epoch_) + std::max(in_future, std::chrono::nanoseconds{0});
+    return static_cast<std::uint64_t>((elapsed + resolution_ - std::chrono::nanoseconds{1}) / resolution_);
+}
+
+auto
+timer_driver::slack_ticks(std::chrono::nanoseconds const & slack) const noexcept -> std::uint64_t {
+    return static_cast<std::uint64_t>(std::max(slack, std::chrono::nanoseconds{0}) / resolution_);
+}
+
+auto
+timer_driver::entry_at(std::uint32_t const slot) const noexcept -> entry & {
+    std::uint32_t const chunk = static_cast<std::uint32_t>(std::bit_width(slot / first_chunk_size + 1)) - 1;
+    std::uint32_t const offset = slot - first_chunk_size * ((std::uint32_t{1} << chunk) - 1);
+    return chunks_[chunk][offset];
+}
+
+auto
+timer_driver::acquire_slot() -> std::uint32_t {
+    while (true) {
+        std::uint64_t head = free_slots_.load(std::memory_order::acquire);
+        while (static_cast<std::uint32_t>(head) != timer_handle::invalid_slot) {
+            std::uint32_t const slot = static_cast<std::uint32_t>(head);
+            std::uint32_t const next = entry_at(slot).next_free.load(std::memory_order::relaxed);
+            std::uint64_t const tag = (head >> 32) + 1;
+            if (free_slots_.compare_exchange_weak(head, (tag << 32) | next, std::memory_order::acq_rel, std::memory_order::acquire)) {
+                return slot;
+            }
+        }
+
+        grow();
+    }
+}
+
+void
+timer_driver::release_slot(entry & e) noexcept {
+    std::uint64_t head = free_slots_.load(std::memory_order::relaxed);
+    do {
+        e.next_free.store(static_cast<std::uint32_t>(head), std::memory_order::relaxed);
+    } while (!free_slots_.compare_exchange_weak(head, (((head >> 32) + 1) << 32) | e.slot, std::memory_order::release, std::memory_order::relaxed));
+}
+
+void
+timer_driver::grow() {
+    std::lock_guard<std::mutex> lock{grow_mutex_};
+
+    // Another caller may have grown the pool, or the reap chain released slots, meanwhile
+    if (static_cast<std::uint32_t>(free_slots_.load(std::memory_order::acquire)) != timer_handle::invalid_slot) {
+        return;
+    }
+
+    std::uint32_t const first = allocated_slots_.load(std::memory_order::relaxed);
+    std::size_t const chunk = static_cast<std::size_t>(std::bit_width(first / first_chunk_size + 1)) - 1;
+    if (chunk == max_chunks) {
+        throw std::bad_alloc{};
+    }
+
+    std::uint32_t const size = first_chunk_size << chunk;
+    chunks_[chunk] = std::make_unique<entry[]>(size);
+    for (std::uint32_t i = 0; i != size; ++i) {
+        chunks_[chunk][i].slot = first + i;
+        chunks_[chunk][i].next_free.store(first + i + 1, std::memory_order::relaxed);
+    }
+    allocated_slots_.store(first + size, std::memory_order::release);
+
+    // Splice the new chunk onto the free list in one step
+    entry & last = chunks_[chunk][size - 1];
+    std::uint64_t head = free_slots_.load(std::memory_order::relaxed);
+    do {
+        last.next_free.store(static_cast<std::uint32_t>(head), std::memory_order::relaxed);
+    } while (!free_slots_.compare_exchange_weak(head, (((head >> 32) + 1) << 32) | first, std::memory_order::release, std::memory_order::relaxed));
+}
+
+auto
+timer_driver::claim(timer_handle const handle, entry_status const next) noexcept -> entry * {
+    if (!handle || handle.slot >= allocated_slots_.load(std::memory_order::acquire)) {
+        return nullptr;
+    }
+
+    entry & e = entry_at(handle.slot);
+    std::uint64_t const armed = control_of(handle.generation, entry_status::armed);
+    std::uint64_t const firing = control_of(handle.generation, entry_status::firing);
+    std::uint64_t expected = armed;
+    while (!e.control.compare_exchange_weak(expected, control_of(handle.generation, next), std::memory_order::acq_rel, std::memory_order::acquire)) {
+        if (expected == firing) {
+            // The callback calling back in runs on the strand; anyone else waits for it to return
+            if (strand_.running_in_this_thread()) {
+                continue;
+            }
+            e.control.wait(firing, std::memory_order::acquire);
+        } else if (expected == control_of(handle.generation, entry_status::rescheduling)) {
+            std::this_thread::yield();
+        } else if (expected != armed) {
+            return nullptr;
+        }
+        expected = armed;
+    }
+    return &e;
+}
+
+void
+timer_driver::enqueue(entry & e) noexcept {
+    // Pairs with the reap chain clearing `queued` before it reads the control word: either it
+    // sees this change, or this call sees the flag cleared and pushes the entry again
+    if (e.queued.exchange(true, std::memory_order::seq_cst)) {
+        return;
+    }
+
+    entry * head = inbox_.load(std::memory_order::relaxed);
+    do {
+        e.next_queued = head;
+    } while (!inbox_.compare_exchange_weak(head, &e, std::memory_order::release, std::memory_order::relaxed));
+}
+
+void
+timer_driver::drain_inbox() {
+    entry * e = inbox_.exchange(nullptr, std::memory_order::acquire);
+    while (e != nullptr) {
+        entry * next = e->next_queued;
+        e->queued.store(false, std::memory_order::seq_cst);
+        reconcile(*e);
+        e = next;
+    }
+}
+
+void
+timer_driver::reconcile(entry & e) {
+    std::uint64_t const control = e.control.load(std::memory_order::seq_cst);
+    switch (status_of(control)) {
+    case entry_status::armed:
+        if (e.linked()) {
+            wheel_.erase(&e);
+        }
+        e.deadline = e.requested_deadline.load(std::memory_order::relaxed);
+        wheel_.insert(&e, e.requested_expiry.load(std::memory_order::relaxed));
+        break;
+
+    case entry_status::cancelled:
+        if (e.linked()) {
+            wheel_.erase(&e);
+        }
+        retire(e, control);
+        break;
+
+    default:
+        // Free entries were retired already; a rescheduling one is pushed again when it is done
+        break;
+    }
+}
+
+void
+timer_driver::retire(entry & e, std::uint64_t const control) noexcept {
+    e.callback = nullptr;
+    e.control.store(control_of(generation_of(control) + 1, entry_status::free), std::memory_order::release);
+    release_slot(e);
+}
+
+void
+timer_driver::fire(entry & e, std::error_code const & ec) {
+    std::uint64_t control = e.control.load(std::memory_order::acquire);
+    while (true) {
+        switch (status_of(control)) {
+        case entry_status::armed:
+            if (e.control.compare_exchange_weak(control, control_of(generation_of(control) + 1, entry_status::free), std::memory_order::acq_rel, std::memory_order::acquire)) {
+                // The slot may be reused by the callback itself
+                timer::timeout_callback_t callback = std::move(e.callback);
+                e.callback = nullptr;
+                release_slot(e);
+                pending_.fetch_sub(1, std::memory_order::relaxed);
+                callback(ec);
+                return;
+            }
+            break;
+
+        case entry_status::cancelled:
+            retire(e, control);
+            return;
+
+        default:
+            // Left unlinked, the pending reschedule() files it again
+            return;
+        }
+    }
+}
+
+void
+timer_driver::fire_periodic(entry & e, std::uint64_t const now) {
+    std::uint64_t control = e.control.load(std::memory_order::acquire);
+    while (true) {
+        switch (status_of(control)) {
+        case entry_status::armed:
+            if (e.control.compare_exchange_weak(control, control_of(generation_of(control), entry_status::firing), std::memory_order::acq_rel, std::memory_order::acquire)) {
+                break;
+            }
+            continue;
+
+        case entry_status::cancelled:
+            retire(e, control);
+            return;
+
+        default:
+            // Left unlinked, the pending reschedule() files it again
+            return;
+        }
+        break;
+    }
+
+    // Invoked in place: cancel() never destroys the callback, only the reap chain does. A cancel()
+    // or reschedule() from another thread waits until the entry leaves the firing state.
+    std::uint32_t const generation = generation_of(control);
+    e.callback(std::error_code{});
+
+    // The callback may have cancelled or rescheduled its own timer; a reschedule sits in the
+    // inbox, and its reconcile moves the entry again
+    std::uint64_t after = control_of(generation, entry_status::firing);
+    e.control.compare_exchange_strong(after, control_of(generation, entry_status::armed), std::memory_order::acq_rel, std::memory_order::acquire);
+    e.control.notify_all();
+    if (status_of(after) == entry_status::cancelled) {
+        retire(e, after);
+    } else {
+        e.deadline = next_expiry(e, now);
+        wheel_.insert(&e, e.deadline);
+    }
+}
+
+auto
+timer_driver::next_expiry(entry const & e, std::uint64_t const now) const noexcept -> std::uint64_t {
+    if (e.mode == timer_mode::fixed_delay) {
+        return tick_of(clock_type::now()) + e.period;
+    }
+
+    std::uint64_t const next = e.expiry + e.period;
+    if (next > now) {
+        return next;
+    }
+
+    switch (e.catch_up) {
+    case catch_up_policy::fire_all:
+        // Due right away, the ongoing advance() fires it again
+        return next;
+
+    case catch_up_policy::skip:
+        return e.expiry + ((now - e.expiry) / e.period + 1) * e.period;
+
+    case catch_up_policy::realign:
+    default:
+        return now + e.period;
+    }
+}
+
+void
+timer_driver::abort_pending() {
+    drain_inbox();
+    wheel_.clear([this](timing_wheel_node * node) {
+        fire(*static_cast<entry *>(node), make_error_code(asio::error::operation_aborted));
+    });
 }
 
 auto
@@ -24,60 +306,211 @@ void
 timer_driver::start() {
     assert(!running());
     running(true);
-    do_reap();
+
+    // A chain still winding down from stop() carries on instead
+    if (!reaping_.exchange(true, std::memory_order::acq_rel)) {
+        asio::post(strand_, [this, self = shared_from_this()]() {
+            do_reap();
+        });
+    }
 }
 
 void
 timer_driver::stop() {
     assert(running());
     running(false);
+
+    // The chain may sleep up to reap_interval_ before it notices; wake it to abort pending timers
+    wake_up();
+}
+
+auto
+timer_driver::arm(std::uint64_t const deadline,
+                  std::uint64_t const expiry,
+                  timer::timeout_callback_t callback,
+                  std::uint64_t const period,
+                  timer_mode const mode,
+                  catch_up_policy const catch_up) -> timer_handle {
+    std::uint32_t const slot = acquire_slot();
+    entry & e = entry_at(slot);
+    e.callback = std::move(callback);
+    e.period = period;
+    e.mode = mode;
+    e.catch_up = catch_up;
+    e.requested_deadline.store(deadline, std::memory_order::relaxed);
+    e.requested_expiry.store(expiry, std::memory_order::relaxed);
+
+    std::uint32_t const generation = generation_of(e.control.load(std::memory_order::relaxed));
+    pending_.fetch_add(1, std::memory_order::relaxed);
+    e.control.store(control_of(generation, entry_status::armed), std::memory_order::seq_cst);
+    enqueue(e);
+    wake_for(expiry);
+    return timer_handle{slot, generation};
 }
 
 void
-timer_driver::schedule(std::chrono::milliseconds const & ms_in_future, timer::timeout_callback_t callback) {
-    if (!running()) {
-        return;
+timer_driver::wake_for(std::uint64_t const expiry) {
+    // Pairs with the reap chain publishing armed_tick_ before it looks at the inbox: either it
+    // finds the entry pushed before this call, or this call sees the tick it is going to sleep for
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    if (expiry < armed_tick_.load(std::memory_order::relaxed)) {
+        wake_up();
     }
-
-    std::lock_guard<std::mutex> lock{timers_mutex_};
-    timers_.emplace_back(std::make_unique<timer>(io_context_, ms_in_future, std::move(callback)));
 }
 
 void
-timer_driver::do_reap() {
-    if (!running()) {
+timer_driver::wake_up() {
+    if (wake_pending_.exchange(true, std::memory_order::acq_rel)) {
         return;
     }
 
-    {
-        std::lock_guard<std::mutex> lock{timers_mutex_};
+    asio::post(strand_, [this, self = shared_from_this()]() {
+        wake_pending_.store(false, std::memory_order::release);
+        reap_alarm_.cancel();
+    });
+}
 
-        auto it = std::begin(timers_);
-        while (it != std::end(timers_)) {
-            if ((*it)->expired()) {
-                (*it)->wait();
-                it = timers_.erase(it);
-            } else {
-                ++it;
-            }
-        }
+auto
+timer_driver::schedule(std::chrono::nanoseconds const & in_future, timer::timeout_callback_t callback, std::chrono::nanoseconds const & slack) -> timer_handle {
+    if (!running()) {
+        return timer_handle{};
     }
 
+    std::uint64_t const deadline = deadline_of(in_future);
+    std::uint64_t const expiry = timing_wheel::coalesce(deadline, slack_ticks(slack));
+    return arm(deadline, expiry, std::move(callback), 0, timer_mode::fixed_rate, catch_up_policy::skip);
+}
+
+auto
+timer_driver::schedule_periodic(std::chrono::nanoseconds const & period, timer::timeout_callback_t callback, timer_mode const mode, catch_up_policy const catch_up) -> timer_handle {
     if (!running()) {
-        return;
+        return timer_handle{};
     }
 
-    timers_.emplace_back(std::make_unique<timer>(io_context_, reap_interval_, [this, self = shared_from_this()](std::error_code const & ec) {
-        if (ec && ec == asio::error::operation_aborted) {
+    // Whole ticks, rounded up like deadlines are
+    auto const period_ticks = std::max<std::uint64_t>(static_cast<std::uint64_t>((std::max(period, std::chrono::nanoseconds{0}) + resolution_ - std::chrono::nanoseconds{1}) / resolution_), 1);
+    std::uint64_t const deadline = deadline_of(resolution_ * static_cast<std::int64_t>(period_ticks));
+    return arm(deadline, deadline, std::move(callback), period_ticks, mode, catch_up);
+}
+
+auto
+timer_driver::cancel(timer_handle const handle) -> bool {
+    entry * e = claim(handle, entry_status::cancelled);
+    if (e == nullptr) {
+        return false;
+    }
+
+    pending_.fetch_sub(1, std::memory_order::relaxed);
+    enqueue(*e);
+    return true;
+}
+
+auto
+timer_driver::reschedule(timer_handle const handle, std::chrono::nanoseconds const & in_future, std::chrono::nanoseconds const & slack) -> bool {
+    std::uint64_t const deadline = deadline_of(in_future);
+    std::uint64_t const expiry = timing_wheel::coalesce(deadline, slack_ticks(slack));
+    entry * e = claim(handle, entry_status::rescheduling);
+    if (e == nullptr) {
+        return false;
+    }
+
+    e->requested_deadline.store(deadline, std::memory_order::relaxed);
+    e->requested_expiry.store(expiry, std::memory_order::relaxed);
+    e->control.store(control_of(handle.generation, entry_status::armed), std::memory_order::seq_cst);
+    enqueue(*e);
+    wake_for(expiry);
+    return true;
+}
+
+auto
+timer_driver::pending() const noexcept -> std::size_t {
+    return pending_.load(std::memory_order::relaxed);
+}
+
+auto
+timer_driver::resolution() const noexcept -> std::chrono::nanoseconds {
+    return resolution_;
+}
+
+auto
+timer_driver::wakeups() const noexcept -> std::uint64_t {
+    return wakeups_.load(std::memory_order::relaxed);
+}
+
+auto
+timer_driver::wakeups_avoided() const noexcept -> std::uint64_t {
+    return wakeups_avoided_.load(std::memory_order::relaxed);
+}
+
+void
+timer_driver::count_coalesced(std::uint64_t const distinct_expiries) {
+    std::sort(fired_deadlines_.begin(), fired_deadlines_.end());
+    auto const distinct_deadlines = static_cast<std::uint64_t>(std::unique(fired_deadlines_.begin(), fired_deadlines_.end()) - fired_deadlines_.begin());
+    if (distinct_deadlines > distinct_expiries) {
+        wakeups_avoided_.fetch_add(distinct_deadlines - distinct_expiries, std::memory_order::relaxed);
+    }
+}
+
+void
+timer_driver::do_reap() {
+    if (!running()) {
+        abort_pending();
+        reaping_.store(false, std::memory_order::seq_cst);
+
+        // A start() that found this chain still alive left the reaping to it
+        if (!running() || reaping_.exchange(true, std::memory_order::acq_rel)) {
             return;
         }
+    }
+
+    wakeups_.fetch_add(1, std::memory_order::relaxed);
+    armed_tick_.store(0, std::memory_order::seq_cst);
+    drain_inbox();
+
+    auto const reaped_at = clock_type::now();
+    std::uint64_t const now = tick_of(reaped_at);
+    std::uint64_t distinct_expiries = 0;
+    std::uint64_t last_expiry = std::numeric_limits<std::uint64_t>::max();
+    bool coalesced = false;
+    fired_deadlines_.clear();
+    wheel_.advance(now, [&](timing_wheel_node * node) {
+        auto & e = *static_cast<entry *>(node);
+        if (e.expiry != last_expiry) {
+            ++distinct_expiries;
+            last_expiry = e.expiry;
+        }
+        fired_deadlines_.push_back(e.deadline);
+        coalesced = coalesced || e.deadline != e.expiry;
 
-        if (!running()) {
-            return;
+        if (e.period != 0) {
+            fire_periodic(e, now);
+        } else {
+            fire(e, std::error_code{});
         }
+    });
+    if (coalesced) {
+        count_coalesced(distinct_expiries);
+    }
 
+    std::uint64_t next = wheel_.next_wakeup();
+    armed_tick_.store(next, std::memory_order::seq_cst);
+    if (inbox_.load(std::memory_order::seq_cst) != nullptr) {
+        // Submitted while the chain was awake, so without a wake-up of their own
+        drain_inbox();
+        next = std::min(next, wheel_.next_wakeup());
+        armed_tick_.store(next, std::memory_order::seq_cst);
+    }
+
+    auto wake_at = reaped_at + reap_interval_;
+    if (next < tick_of(wake_at)) {
+        wake_at = time_of(next);
+    }
+
+    reap_alarm_.expires_at(wake_at);
+    reap_alarm_.async_wait([this, self = shared_from_this()](std::error_code const &) {
+        // Cancelled by wake_for() or expired alike, reap now
         do_reap();
-    }));
+    });
 }
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,154 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & abc contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <abc/timing_wheel.h>
+
+#include <bit>
+#include <cassert>
+
+namespace abc {
+
+timing_wheel::timing_wheel(std::uint64_t const now) noexcept : now_{ now } {
+}
+
+auto
+timing_wheel::digit(std::uint64_t const tick, std::size_t const level) noexcept -> std::size_t {
+    return static_cast<std::size_t>(tick >> (level * level_bits)) & (slots_per_level - 1);
+}
+
+auto
+timing_wheel::coalesce(std::uint64_t const deadline, std::uint64_t const slack) noexcept -> std::uint64_t {
+    if (slack == 0 || deadline == 0) {
+        return deadline;
+    }
+
+    // Clearing the bits below the highest one in which `latest` and `deadline - 1` differ keeps
+    // the result above `deadline - 1`; clearing that bit as well would not
+    std::uint64_t const latest = slack > std::numeric_limits<std::uint64_t>::max() - deadline ? std::numeric_limits<std::uint64_t>::max() : deadline + slack;
+    std::uint64_t const diff = latest ^ (deadline - 1);
+    std::uint64_t const low_bits = (std::uint64_t{1} << (63 - std::countl_zero(diff))) - 1;
+    return latest & ~low_bits;
+}
+
+auto
+timing_wheel::link(timing_wheel_node * node) noexcept -> void {
+    std::size_t level = 0;
+    std::size_t slot = digit(now_, 0);
+    if (node->expiry > now_) {
+        std::uint64_t const diff = node->expiry ^ now_;
+        level = static_cast<std::size_t>(63 - std::countl_zero(diff)) / level_bits;
+        slot = digit(node->expiry, level);
+    }
+
+    std::size_t const bucket = level * slots_per_level + slot;
+    node->bucket = static_cast<std::uint16_t>(bucket);
+    node->prev = nullptr;
+    node->next = buckets_[bucket];
+    if (node->next != nullptr) {
+        node->next->prev = node;
+    }
+    buckets_[bucket] = node;
+    occupied_[level] |= std::uint64_t{1} << slot;
+}
+
+auto
+timing_wheel::unlink(timing_wheel_node * node) noexcept -> void {
+    std::size_t const bucket = node->bucket;
+    if (node->prev != nullptr) {
+        node->prev->next = node->next;
+    } else {
+        buckets_[bucket] = node->next;
+        if (node->next == nullptr) {
+            occupied_[bucket / slots_per_level] &= ~(std::uint64_t{1} << (bucket % slots_per_level));
+        }
+    }
+    if (node->next != nullptr) {
+        node->next->prev = node->prev;
+    }
+
+    node->prev = nullptr;
+    node->next = nullptr;
+    node->bucket = timing_wheel_node::unlinked;
+}
+
+auto
+timing_wheel::cascade(std::size_t const level) noexcept -> void {
+    std::size_t const slot = digit(now_, level);
+    std::size_t const bucket = level * slots_per_level + slot;
+
+    timing_wheel_node * node = buckets_[bucket];
+    buckets_[bucket] = nullptr;
+    occupied_[level] &= ~(std::uint64_t{1} << slot);
+
+    while (node != nullptr) {
+        timing_wheel_node * next = node->next;
+        link(node);
+        node = next;
+    }
+}
+
+auto
+timing_wheel::pop_due() noexcept -> timing_wheel_node * {
+    timing_wheel_node * node = buckets_[digit(now_, 0)];
+    if (node != nullptr) {
+        unlink(node);
+        --size_;
+    }
+    return node;
+}
+
+auto
+timing_wheel::insert(timing_wheel_node * node, std::uint64_t const expiry) noexcept -> void {
+    assert(!node->linked());
+    node->expiry = expiry;
+    link(node);
+    ++size_;
+}
+
+auto
+timing_wheel::erase(timing_wheel_node * node) noexcept -> void {
+    assert(node->linked());
+    unlink(node);
+    --size_;
+}
+
+auto
+timing_wheel::next_wakeup() const noexcept -> std::uint64_t {
+    if (size_ == 0) {
+        return std::numeric_limits<std::uint64_t>::max();
+    }
+
+    // Buckets behind the current digit are empty; a lower level always wakes up first
+    for (std::size_t level = 0; level != level_count; ++level) {
+        std::size_t const current = digit(now_, level);
+        std::uint64_t const ahead = level == 0 ? ~std::uint64_t{0} << current : (~std::uint64_t{0} << current) << 1;
+        std::uint64_t const candidates = occupied_[level] & ahead;
+        if (candidates == 0) {
+            continue;
+        }
+
+        std::size_t const shift = (level + 1) * level_bits;
+        std::uint64_t const base = shift >= 64 ? 0 : now_ >> shift << shift;
+        return base | (static_cast<std::uint64_t>(std::countr_zero(candidates)) << (level * level_bits));
+    }
+
+    assert(false);
+    return std::numeric_limits<std::uint64_t>::max();
+}
+
+auto
+timing_wheel::now() const noexcept -> std::uint64_t {
+    return now_;
+}
+
+auto
+timing_wheel::size() const noexcept -> std::size_t {
+    return size_;
+}
+
+auto
+timing_wheel::empty() const noexcept -> bool {
+    return size_ == 0;
+}
+
+}
@@ -0,0 +1,281 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <abc/async/broadcast_ring.h>
+
+#include <exec/inline_scheduler.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(async_broadcast_ring, every_consumer_reads_every_item)
+{
+    using namespace abc::async;
+
+    BroadcastRing<std::string, 4, exec::inline_scheduler> ring(exec::inline_scheduler{});
+    auto & first = ring.add_consumer();
+    auto & second = ring.add_consumer();
+
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(ring.try_publish(std::to_string(i)));
+    }
+
+    // Neither consumer has read the oldest item, so the ring is full
+    EXPECT_FALSE(ring.try_publish(std::string{ "4" }));
+
+    std::vector<std::string> seen;
+    EXPECT_EQ(ring.read(first, [&](std::string const & item) { seen.push_back(item); }), 4u);
+    EXPECT_EQ(seen, (std::vector<std::string>{ "0", "1", "2", "3" }));
+    EXPECT_EQ(first.sequence(), 4u);
+    EXPECT_EQ(ring.read(first, [](std::string const &) {}), 0u);
+
+    // The slowest consumer gates the producer
+    EXPECT_FALSE(ring.try_publish(std::string{ "4" }));
+    EXPECT_EQ(ring.read(second, [](std::string const &) {}, 1), 1u);
+    EXPECT_TRUE(ring.try_publish(std::string{ "4" }));
+    EXPECT_FALSE(ring.try_publish(std::string{ "5" }));
+
+    seen.clear();
+    EXPECT_EQ(ring.read(second, [&](std::string const & item) { seen.push_back(item); }), 4u);
+    EXPECT_EQ(seen, (std::vector<std::string>{ "1", "2", "3", "4" }));
+    EXPECT_EQ(ring.claimed(), 5u);
+}
+
+TEST(async_broadcast_ring, items_are_read_in_place)
+{
+    using namespace abc::async;
+
+    BroadcastRing<int, 8, exec::inline_scheduler> ring(exec::inline_scheduler{});
+    auto & first = ring.add_consumer();
+    auto & second = ring.add_consumer();
+
+    EXPECT_TRUE(ring.try_emplace(42));
+
+    int const * seen_by_first = nullptr;
+    int const * seen_by_second = nullptr;
+    ring.read(first, [&](int const & item) { seen_by_first = &item; });
+    ring.read(second, [&](int const & item) { seen_by_second = &item; });
+
+    ASSERT_NE(seen_by_first, nullptr);
+    EXPECT_EQ(seen_by_first, seen_by_second);
+    EXPECT_EQ(*seen_by_first, 42);
+}
+
+TEST(async_broadcast_ring, downstream_stage_waits_for_upstream)
+{
+    using namespace abc::async;
+
+    BroadcastRing<int, 8, exec::inline_scheduler> ring(exec::inline_scheduler{});
+    auto & decode = ring.add_consumer();
+    auto & persist = ring.add_consumer({ &decode });
+
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(ring.try_publish(i));
+    }
+
+    EXPECT_EQ(ring.read(persist, [](int) {}), 0u);
+    EXPECT_EQ(ring.read(decode, [](int) {}, 2), 2u);
+
+    std::vector<int> seen;
+    EXPECT_EQ(ring.read(persist, [&](int item) { seen.push_back(item); }), 2u);
+    EXPECT_EQ(seen, (std::vector<int>{ 0, 1 }));
+}
+
+TEST(async_broadcast_ring, consumers_must_be_added_before_publishing)
+{
+    using namespace abc::async;
+
+    BroadcastRing<int, 8, exec::inline_scheduler> ring(exec::inline_scheduler{});
+    ring.add_consumer();
+    EXPECT_TRUE(ring.try_publish(1));
+    EXPECT_THROW(ring.add_consumer(), abc::abc_error);
+}
+
+TEST(async_broadcast_ring, overwritten_and_remaining_items_are_destroyed)
+{
+    using namespace abc::async;
+
+    auto const tracker = std::make_shared<int>(0);
+    {
+        BroadcastRing<std::shared_ptr<int>, 4, exec::inline_scheduler> ring(exec::inline_scheduler{});
+        auto & consumer = ring.add_consumer();
+
+        for (int i = 0; i < 10; ++i)
+        {
+            EXPECT_TRUE(ring.try_publish(tracker));
+            ring.read(consumer, [](std::shared_ptr<int> const &) {});
+        }
+
+        // Read items stay in their slot until the slot is reused
+        EXPECT_EQ(tracker.use_count(), 5);
+    }
+    EXPECT_EQ(tracker.use_count(), 1);
+}
+
+TEST(async_broadcast_ring, reader_exception_still_advances_the_cursor)
+{
+    using namespace abc::async;
+
+    BroadcastRing<int, 4, exec::inline_scheduler> ring(exec::inline_scheduler{});
+    auto & consumer = ring.add_consumer();
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(ring.try_publish(i));
+    }
+
+    EXPECT_THROW(ring.read(consumer,
+                           [](int item) {
+                               if (item == 1)
+                               {
+                                   throw std::runtime_error("bad item");
+                               }
+                           }),
+                 std::runtime_error);
+    EXPECT_EQ(consumer.sequence(), 2u);
+}
+
+TEST(async_broadcast_ring, producers_without_consumers_never_lap_an_unpublished_slot)
+{
+    using namespace abc::async;
+    constexpr int num_producers = 4;
+    constexpr int items_per_producer = 20000;
+
+    // Nothing reads, so producers keep wrapping the ring; none may destroy or overwrite an item
+    // another producer is still constructing
+    std::atomic<int> published{ 0 };
+    {
+        BroadcastRing<std::string, 8, exec::inline_scheduler, ProducerCardinality::Multi> ring(exec::inline_scheduler{});
+        std::vector<std::thread> producers;
+        for (int p = 0; p < num_producers; ++p)
+        {
+            producers.emplace_back([&ring, &published, p]() {
+                for (int i = 0; i < items_per_producer; ++i)
+                {
+                    // Long enough to live on the heap
+                    if (ring.try_publish(std::string(64, static_cast<char>('a' + p))))
+                    {
+                        ++published;
+                    }
+                }
+            });
+        }
+        for (auto & producer : producers)
+        {
+            producer.join();
+        }
+
+        EXPECT_EQ(ring.claimed(), static_cast<std::size_t>(published.load()));
+    }
+}
+
+namespace
+{
+
+// Constructor that may throw, move that does not
+struct Picky
+{
+    explicit Picky(int v) : value{ v }
+    {
+        if (v < 0)
+        {
+            throw std::invalid_argument("negative");
+        }
+    }
+
+    Picky(Picky &&) noexcept = default;
+
+    int value;
+};
+
+} // namespace
+
+TEST(async_broadcast_ring, throwing_constructor_leaves_no_hole)
+{
+    using namespace abc::async;
+
+    BroadcastRing<Picky, 4, exec::inline_scheduler> ring(exec::inline_scheduler{});
+    auto & consumer = ring.add_consumer();
+
+    EXPECT_TRUE(ring.try_emplace(1));
+    EXPECT_THROW(ring.try_emplace(-1), std::invalid_argument);
+    EXPECT_TRUE(ring.try_emplace(2));
+    EXPECT_EQ(ring.claimed(), 2u);
+
+    std::vector<int> seen;
+    EXPECT_EQ(ring.read(consumer, [&](Picky const & item) { seen.push_back(item.value); }), 2u);
+    EXPECT_EQ(seen, (std::vector<int>{ 1, 2 }));
+}
+
+namespace
+{
+
+// Two producers fan items out to a diamond: `parse` and `audit` read the ring directly,
+// `store` reads an item only after both have.
+template <abc::async::BroadcastWaitStrategy WaitV>
+void
+run_async_pipeline()
+{
+    using namespace abc::async;
+    constexpr int items_per_producer = 1000;
+    constexpr long expected_sum = 2L * items_per_producer * (items_per_producer - 1) / 2;
+
+    exec::static_thread_pool pool{ 2 };
+    BroadcastRing<int, 16, exec::static_thread_pool::scheduler, ProducerCardinality::Multi, WaitV> ring(pool.get_scheduler());
+    auto & parse = ring.add_consumer();
+    auto & audit = ring.add_consumer();
+    auto & store = ring.add_consumer({ &parse, &audit });
+
+    std::atomic<long> parse_sum{ 0 };
+    std::atomic<long> audit_sum{ 0 };
+    std::atomic<long> store_sum{ 0 };
+    std::atomic<bool> store_overtook{ false };
+
+    auto producer = [&]() -> exec::task<void> {
+        for (int i = 0; i < items_per_producer; ++i)
+        {
+            co_await ring.async_publish(i);
+        }
+    };
+
+    auto stage = [&](auto & consumer, std::atomic<long> & sum) -> exec::task<void> {
+        std::size_t read = 0;
+        while (read < 2 * items_per_producer)
+        {
+            read += co_await ring.async_read(consumer, [&](int item) {
+                sum += item;
+                if (&consumer == &store && (parse.sequence() <= store.sequence() || audit.sequence() <= store.sequence()))
+                {
+                    store_overtook = true;
+                }
+            });
+        }
+    };
+
+    stdexec::sync_wait(stdexec::when_all(stage(parse, parse_sum), stage(audit, audit_sum), stage(store, store_sum), producer(), producer()));
+
+    EXPECT_EQ(parse_sum.load(), expected_sum);
+    EXPECT_EQ(audit_sum.load(), expected_sum);
+    EXPECT_EQ(store_sum.load(), expected_sum);
+    EXPECT_FALSE(store_overtook.load());
+    EXPECT_EQ(store.sequence(), 2u * items_per_producer);
+}
+
+} // namespace
+
+TEST(async_broadcast_ring, async_pipeline_parking)
+{
+    run_async_pipeline<abc::async::BroadcastWaitStrategy::Park>();
+}
+
+TEST(async_broadcast_ring, async_pipeline_yielding)
+{
+    run_async_pipeline<abc::async::BroadcastWaitStrategy::Yield>();
+}
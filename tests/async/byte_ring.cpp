@@ -0,0 +1,196 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <abc/async/byte_ring.h>
+
+#include <exec/inline_scheduler.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+// Message of `size` bytes whose content depends on `seed`
+auto
+make_message(std::size_t const size, std::uint32_t const seed) -> std::vector<abc::byte_t>
+{
+    std::vector<abc::byte_t> message(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        message[i] = static_cast<abc::byte_t>(seed * 31 + i);
+    }
+    return message;
+}
+
+} // namespace
+
+TEST(async_byte_ring, variable_length_round_trip_across_wrap_around)
+{
+    using namespace abc::async;
+
+    ByteRing<256, exec::inline_scheduler, QueueCardinality::Spsc> ring(exec::inline_scheduler{});
+    EXPECT_TRUE(ring.empty());
+    EXPECT_FALSE(ring.try_read().has_value());
+
+    // Sizes are chosen so records keep landing across the end of the ring
+    for (std::uint32_t i = 0; i < 500; ++i)
+    {
+        auto const message = make_message(i % 61, i);
+        ASSERT_TRUE(ring.try_write(message));
+
+        auto const view = ring.try_read();
+        ASSERT_TRUE(view.has_value());
+        ASSERT_EQ(view->size(), message.size());
+        EXPECT_TRUE(std::equal(view->begin(), view->end(), message.begin()));
+        ring.commit_read();
+    }
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(async_byte_ring, message_is_read_in_place_until_committed)
+{
+    using namespace abc::async;
+
+    ByteRing<128, exec::inline_scheduler> ring(exec::inline_scheduler{});
+
+    auto reserved = ring.try_reserve(5);
+    ASSERT_TRUE(reserved.has_value());
+    std::memcpy(reserved->data(), "hello", 5);
+
+    // Not visible before commit
+    EXPECT_FALSE(ring.try_read().has_value());
+    ring.commit(*reserved);
+
+    auto const first = ring.try_read();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first->data(), reserved->data());
+    EXPECT_EQ(first->size(), 5u);
+
+    // Until commit_read() the same message is returned
+    auto const again = ring.try_read();
+    ASSERT_TRUE(again.has_value());
+    EXPECT_EQ(again->data(), first->data());
+
+    ring.commit_read();
+    EXPECT_FALSE(ring.try_read().has_value());
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(async_byte_ring, full_ring_and_oversized_messages)
+{
+    using namespace abc::async;
+
+    ByteRing<64, exec::inline_scheduler> ring(exec::inline_scheduler{});
+    EXPECT_EQ(ring.max_message_size(), 24u);
+    EXPECT_THROW((void)ring.try_reserve(25), abc::abc_error);
+
+    // Two records of 32 bytes fill the ring
+    auto const message = make_message(24, 1);
+    EXPECT_TRUE(ring.try_write(message));
+    EXPECT_TRUE(ring.try_write(message));
+    EXPECT_FALSE(ring.try_write(message));
+    EXPECT_EQ(ring.size(), 64u);
+
+    ASSERT_TRUE(ring.try_read().has_value());
+    ring.commit_read();
+    EXPECT_TRUE(ring.try_write(message));
+}
+
+TEST(async_byte_ring, concurrent_producers_commit_out_of_order)
+{
+    using namespace abc::async;
+    constexpr std::uint32_t num_producers = 4;
+    constexpr std::uint32_t messages_per_producer = 5000;
+
+    ByteRing<1024, exec::inline_scheduler> ring(exec::inline_scheduler{});
+
+    std::vector<std::thread> producers;
+    for (std::uint32_t p = 0; p < num_producers; ++p)
+    {
+        producers.emplace_back([&, p]() {
+            for (std::uint32_t i = 0; i < messages_per_producer; ++i)
+            {
+                // Header: producer and sequence, followed by a seed-dependent body
+                std::size_t const body = (p * 7 + i) % 50;
+                std::optional<std::span<abc::byte_t>> reserved;
+                while (!(reserved = ring.try_reserve(2 * sizeof(std::uint32_t) + body)))
+                {
+                    std::this_thread::yield();
+                }
+                std::memcpy(reserved->data(), &p, sizeof(p));
+                std::memcpy(reserved->data() + sizeof(p), &i, sizeof(i));
+                auto const content = make_message(body, p ^ i);
+                std::memcpy(reserved->data() + 2 * sizeof(std::uint32_t), content.data(), body);
+                ring.commit(*reserved);
+            }
+        });
+    }
+
+    std::vector<std::uint32_t> next(num_producers, 0);
+    for (std::uint32_t received = 0; received < num_producers * messages_per_producer;)
+    {
+        auto const view = ring.try_read();
+        if (!view)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::uint32_t p;
+        std::uint32_t i;
+        std::memcpy(&p, view->data(), sizeof(p));
+        std::memcpy(&i, view->data() + sizeof(p), sizeof(i));
+        ASSERT_LT(p, num_producers);
+        EXPECT_EQ(i, next[p]++);
+
+        auto const content = make_message((p * 7 + i) % 50, p ^ i);
+        ASSERT_EQ(view->size(), 2 * sizeof(std::uint32_t) + content.size());
+        EXPECT_TRUE(std::equal(content.begin(), content.end(), view->begin() + 2 * sizeof(std::uint32_t)));
+
+        ring.commit_read();
+        ++received;
+    }
+
+    for (auto & producer : producers)
+    {
+        producer.join();
+    }
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(async_byte_ring, async_round_trip_with_backpressure)
+{
+    using namespace abc::async;
+    constexpr std::uint32_t num_messages = 2000;
+
+    exec::static_thread_pool pool{ 2 };
+    ByteRing<128, exec::static_thread_pool::scheduler> ring(pool.get_scheduler());
+
+    auto producer = [&]() -> exec::task<void> {
+        for (std::uint32_t i = 0; i < num_messages; ++i)
+        {
+            co_await ring.async_write(make_message(i % 40, i));
+        }
+    };
+
+    auto consumer = [&]() -> exec::task<void> {
+        for (std::uint32_t i = 0; i < num_messages; ++i)
+        {
+            auto const view = co_await ring.async_read();
+            auto const expected = make_message(i % 40, i);
+            EXPECT_EQ(view.size(), expected.size());
+            EXPECT_TRUE(std::equal(view.begin(), view.end(), expected.begin()));
+            ring.commit_read();
+        }
+    };
+
+    stdexec::sync_wait(stdexec::when_all(consumer(), producer()));
+    EXPECT_TRUE(ring.empty());
+}
@@ -0,0 +1,272 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <abc/async/deadline_queue.h>
+
+#include <exec/inline_scheduler.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using namespace std::chrono_literals;
+
+// Drop handler recording every batch it is given
+struct DropLog
+{
+    std::mutex mutex;
+    std::vector<std::vector<int>> batches;
+    std::vector<abc::async::DropReason> reasons;
+
+    auto
+    handler()
+    {
+        return [this](std::span<int> const items, abc::async::DropReason const reason) {
+            std::lock_guard lock{ mutex };
+            batches.emplace_back(items.begin(), items.end());
+            reasons.push_back(reason);
+        };
+    }
+};
+
+} // namespace
+
+TEST(async_deadline_queue, expired_items_are_skipped_counted_and_handed_over)
+{
+    using namespace abc::async;
+
+    DropLog log;
+    DeadlineQueue<int, 16, exec::inline_scheduler> queue(exec::inline_scheduler{}, 16, log.handler());
+    auto const past = std::chrono::steady_clock::now() - 1s;
+    auto const future = std::chrono::steady_clock::now() + 1h;
+
+    EXPECT_TRUE(queue.enqueue(0, past));
+    EXPECT_TRUE(queue.enqueue(1, past));
+    EXPECT_TRUE(queue.enqueue(2, past));
+    EXPECT_TRUE(queue.enqueue(3, future));
+    EXPECT_TRUE(queue.enqueue(4, past));
+    EXPECT_TRUE(queue.enqueue_within(5, 1h));
+
+    EXPECT_EQ(queue.dequeue(), 3);
+    EXPECT_EQ(queue.expired_count(), 3u);
+    EXPECT_EQ(queue.dequeue(), 5);
+    EXPECT_EQ(queue.expired_count(), 4u);
+    EXPECT_FALSE(queue.dequeue().has_value());
+    EXPECT_TRUE(queue.empty());
+
+    ASSERT_EQ(log.batches.size(), 2u);
+    EXPECT_EQ(log.batches[0], (std::vector<int>{ 0, 1, 2 }));
+    EXPECT_EQ(log.batches[1], (std::vector<int>{ 4 }));
+    EXPECT_EQ(log.reasons[0], DropReason::Expired);
+    EXPECT_EQ(queue.shed_count(), 0u);
+    EXPECT_EQ(queue.rejected_count(), 0u);
+}
+
+TEST(async_deadline_queue, drop_batches_are_bounded)
+{
+    using namespace abc::async;
+
+    DropLog log;
+    DeadlineQueue<int, 64, exec::inline_scheduler> queue(exec::inline_scheduler{}, 64, log.handler());
+    for (int i = 0; i < 40; ++i)
+    {
+        EXPECT_TRUE(queue.enqueue(i, std::chrono::steady_clock::now() - 1s));
+    }
+
+    EXPECT_FALSE(queue.dequeue().has_value());
+    EXPECT_EQ(queue.expired_count(), 40u);
+    ASSERT_EQ(log.batches.size(), 3u);
+    EXPECT_EQ(log.batches[0].size(), 16u);
+    EXPECT_EQ(log.batches[1].size(), 16u);
+    EXPECT_EQ(log.batches[2].size(), 8u);
+    EXPECT_EQ(log.batches[2].back(), 39);
+}
+
+TEST(async_deadline_queue, reject_newest_at_watermark)
+{
+    using namespace abc::async;
+
+    DeadlineQueue<int, 16, exec::inline_scheduler> queue(exec::inline_scheduler{}, 4);
+    EXPECT_EQ(queue.high_watermark(), 4u);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(queue.enqueue_within(i, 1h));
+    }
+    EXPECT_FALSE(queue.enqueue_within(4, 1h));
+    EXPECT_EQ(queue.rejected_count(), 1u);
+    EXPECT_EQ(queue.size(), 4u);
+
+    EXPECT_EQ(queue.dequeue(), 0);
+    EXPECT_TRUE(queue.enqueue_within(4, 1h));
+    EXPECT_EQ(queue.rejected_count(), 1u);
+}
+
+TEST(async_deadline_queue, drop_oldest_sheds_from_the_head)
+{
+    using namespace abc::async;
+
+    DropLog log;
+    DeadlineQueue<int, 16, exec::inline_scheduler, OverloadPolicy::DropOldest> queue(exec::inline_scheduler{}, 4, log.handler());
+
+    // The expired head is dropped as expired, the live ones after it are shed
+    EXPECT_TRUE(queue.enqueue(0, std::chrono::steady_clock::now() - 1s));
+    for (int i = 1; i < 10; ++i)
+    {
+        EXPECT_TRUE(queue.enqueue_within(i, 1h));
+        EXPECT_LE(queue.size(), 4u);
+    }
+
+    EXPECT_EQ(queue.expired_count(), 1u);
+    EXPECT_EQ(queue.shed_count(), 5u);
+    EXPECT_EQ(queue.rejected_count(), 0u);
+
+    std::vector<int> shed;
+    for (std::size_t i = 0; i < log.batches.size(); ++i)
+    {
+        if (log.reasons[i] == DropReason::Shed)
+        {
+            shed.insert(shed.end(), log.batches[i].begin(), log.batches[i].end());
+        }
+    }
+    EXPECT_EQ(shed, (std::vector<int>{ 1, 2, 3, 4, 5 }));
+
+    for (int i = 6; i < 10; ++i)
+    {
+        EXPECT_EQ(queue.dequeue(), i);
+    }
+}
+
+TEST(async_deadline_queue, dropped_items_count_as_done_for_join)
+{
+    using namespace abc::async;
+
+    DeadlineQueue<int, 16, exec::inline_scheduler> queue(exec::inline_scheduler{});
+    for (int i = 0; i < 8; ++i)
+    {
+        EXPECT_TRUE(queue.enqueue(i, i % 2 == 0 ? std::chrono::steady_clock::now() - 1s : std::chrono::steady_clock::now() + 1h));
+    }
+
+    std::thread waiter{ [&]() { queue.join_blocking(); } };
+    for (int i = 1; i < 8; i += 2)
+    {
+        EXPECT_EQ(queue.dequeue(), i);
+        queue.task_done();
+    }
+    waiter.join();
+
+    EXPECT_EQ(queue.expired_count(), 4u);
+    EXPECT_THROW(queue.task_done(), abc::abc_error);
+}
+
+TEST(async_deadline_queue, join_waits_for_the_drop_handler)
+{
+    using namespace abc::async;
+
+    std::atomic<bool> joined{ false };
+    std::atomic<bool> handler_saw_joined{ false };
+    auto const handler = [&](std::span<int>, DropReason) {
+        // Gives a join() released too early time to return
+        std::this_thread::sleep_for(50ms);
+        handler_saw_joined = joined.load();
+    };
+
+    DeadlineQueue<int, 16, exec::inline_scheduler> queue(exec::inline_scheduler{}, 16, handler);
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(queue.enqueue(i, std::chrono::steady_clock::now() - 1s));
+    }
+
+    std::thread waiter{ [&]() {
+        queue.join_blocking();
+        joined = true;
+    } };
+    EXPECT_FALSE(queue.dequeue().has_value());
+    waiter.join();
+
+    EXPECT_FALSE(handler_saw_joined.load());
+    EXPECT_EQ(queue.expired_count(), 3u);
+}
+
+TEST(async_deadline_queue, async_dequeue_skips_expired_items)
+{
+    using namespace abc::async;
+    constexpr int num_items = 1000;
+
+    exec::static_thread_pool pool{ 2 };
+    DeadlineQueue<int, 64, exec::static_thread_pool::scheduler> queue(pool.get_scheduler());
+    std::atomic<long> consumed_sum{ 0 };
+
+    // Every odd item is already expired; the even ones are never shed
+    auto producer = [&]() -> exec::task<void> {
+        for (int i = 0; i < num_items; ++i)
+        {
+            auto const deadline = i % 2 == 0 ? std::chrono::steady_clock::now() + 1h : std::chrono::steady_clock::now() - 1s;
+            while (!queue.enqueue(i, deadline))
+            {
+                co_await stdexec::schedule(pool.get_scheduler());
+            }
+        }
+    };
+
+    auto consumer = [&]() -> exec::task<void> {
+        for (int i = 0; i < num_items / 2; ++i)
+        {
+            int const item = co_await queue.async_dequeue();
+            EXPECT_EQ(item % 2, 0);
+            consumed_sum += item;
+            queue.task_done();
+        }
+    };
+
+    stdexec::sync_wait(stdexec::when_all(consumer(), producer()));
+
+    // The last item expired behind the last live one, a further dequeue drops it
+    EXPECT_FALSE(queue.dequeue().has_value());
+    stdexec::sync_wait(queue.join());
+
+    EXPECT_EQ(consumed_sum.load(), static_cast<long>(num_items / 2) * (num_items / 2 - 1));
+    EXPECT_EQ(queue.expired_count(), static_cast<std::uint64_t>(num_items / 2));
+}
+
+TEST(async_deadline_queue, overload_keeps_queue_depth_bounded)
+{
+    using namespace abc::async;
+    constexpr int num_items = 20000;
+    constexpr std::size_t watermark = 32;
+
+    DeadlineQueue<int, 256, exec::inline_scheduler, OverloadPolicy::DropOldest> queue(exec::inline_scheduler{}, watermark);
+    std::atomic<bool> done{ false };
+    std::atomic<int> delivered{ 0 };
+
+    // A consumer much slower than the producer
+    std::thread consumer{ [&]() {
+        while (!done.load() || !queue.empty())
+        {
+            if (queue.dequeue())
+            {
+                ++delivered;
+                std::this_thread::sleep_for(20us);
+            }
+        }
+    } };
+
+    for (int i = 0; i < num_items; ++i)
+    {
+        EXPECT_TRUE(queue.enqueue_within(i, 50ms));
+        EXPECT_LE(queue.size(), watermark);
+    }
+    done = true;
+    consumer.join();
+
+    EXPECT_GT(queue.shed_count(), 0u);
+    EXPECT_EQ(static_cast<std::uint64_t>(delivered.load()) + queue.shed_count() + queue.expired_count(), static_cast<std::uint64_t>(num_items));
+}
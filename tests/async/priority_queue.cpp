@@ -0,0 +1,154 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <abc/async/priority_queue.h>
+
+#include <exec/inline_scheduler.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+
+TEST(async_priority_queue, single_heap_is_exact)
+{
+    using namespace abc::async;
+
+    PriorityQueue<int, exec::inline_scheduler> queue(exec::inline_scheduler{}, 1);
+    EXPECT_EQ(queue.heap_count(), 1u);
+    EXPECT_FALSE(queue.try_pop().has_value());
+
+    std::vector<int> items(1000);
+    std::iota(items.begin(), items.end(), 0);
+    std::shuffle(items.begin(), items.end(), std::mt19937{ 42 });
+    for (int const item : items)
+    {
+        queue.push(item);
+    }
+    EXPECT_EQ(queue.size(), items.size());
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(queue.try_pop(), i);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(async_priority_queue, compare_selects_the_order)
+{
+    using namespace abc::async;
+
+    PriorityQueue<int, exec::inline_scheduler, std::greater<int>> queue(exec::inline_scheduler{}, 1);
+    for (int i = 0; i < 10; ++i)
+    {
+        queue.push(i);
+    }
+    for (int i = 9; i >= 0; --i)
+    {
+        EXPECT_EQ(queue.try_pop(), i);
+    }
+}
+
+TEST(async_priority_queue, rank_error_stays_within_the_documented_bound)
+{
+    using namespace abc::async;
+    constexpr std::size_t heap_count = 8;
+    constexpr int num_items = 4000;
+
+    PriorityQueue<int, exec::inline_scheduler> queue(exec::inline_scheduler{}, heap_count);
+    std::vector<int> items(num_items);
+    std::iota(items.begin(), items.end(), 0);
+    std::shuffle(items.begin(), items.end(), std::mt19937{ 7 });
+    queue.push_bulk(items);
+
+    // Rank of each popped item among the items still queued, 0 being exact
+    std::set<int> remaining(items.begin(), items.end());
+    std::size_t total_rank = 0;
+    std::size_t max_rank = 0;
+    while (auto item = queue.try_pop())
+    {
+        auto const it = remaining.find(*item);
+        ASSERT_NE(it, remaining.end());
+        std::size_t const rank = static_cast<std::size_t>(std::distance(remaining.begin(), it));
+        total_rank += rank;
+        max_rank = std::max(max_rank, rank);
+        remaining.erase(it);
+    }
+
+    EXPECT_TRUE(remaining.empty());
+    // The bound is on the expected rank; single pops have a geometric tail, so only catch outliers
+    EXPECT_LE(total_rank / num_items, 2 * heap_count);
+    EXPECT_LT(max_rank, 32 * heap_count);
+}
+
+TEST(async_priority_queue, try_pop_finds_a_lone_item)
+{
+    using namespace abc::async;
+
+    PriorityQueue<int, exec::inline_scheduler> queue(exec::inline_scheduler{}, 64);
+    for (int i = 0; i < 100; ++i)
+    {
+        queue.push(i);
+        EXPECT_EQ(queue.try_pop(), i);
+        EXPECT_FALSE(queue.try_pop().has_value());
+    }
+}
+
+TEST(async_priority_queue, concurrent_push_and_async_pop)
+{
+    using namespace abc::async;
+    constexpr int num_producers = 4;
+    constexpr int num_consumers = 4;
+    constexpr int num_items = 10000;
+
+    exec::static_thread_pool pool{ 4 };
+    PriorityQueue<int, exec::static_thread_pool::scheduler> queue(pool.get_scheduler());
+    std::atomic<long> consumed_sum{ 0 };
+
+    auto consumer = [&]() -> exec::task<void> {
+        for (int i = 0; i < num_items * num_producers / num_consumers; ++i)
+        {
+            consumed_sum += co_await queue.async_pop();
+        }
+    };
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < num_producers; ++p)
+    {
+        producers.emplace_back([&]() {
+            std::vector<int> batch;
+            for (int i = 0; i < num_items; ++i)
+            {
+                if (i % 3 == 0)
+                {
+                    queue.push(i);
+                }
+                else
+                {
+                    batch.push_back(i);
+                }
+                if (batch.size() == 32 || (i == num_items - 1 && !batch.empty()))
+                {
+                    queue.push_bulk(batch);
+                    batch.clear();
+                }
+            }
+        });
+    }
+
+    stdexec::sync_wait(stdexec::when_all(consumer(), consumer(), consumer(), consumer()));
+    for (auto & producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_EQ(consumed_sum.load(), static_cast<long>(num_producers) * num_items * (num_items - 1) / 2);
+    EXPECT_TRUE(queue.empty());
+}
@@ -8,9 +8,15 @@
 #include <exec/static_thread_pool.hpp>
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
+#include <exception>
+#include <optional>
 #include <stdexcept>
+#include <string>
 #include <thread>
+#include <tuple>
+#include <vector>
 
 TEST(async_queue, sync_enqueue_dequeue)
 {
@@ -909,3 +915,1076 @@ TEST(async_queue, join_immediate_return_after_all_tasks_done)
     // Should complete very quickly (less than 10ms)
     EXPECT_LT(duration.count(), 10);
 }
+
+TEST(async_queue, many_join_waiters_resumed_by_last_task_done)
+{
+    using namespace abc::async;
+    constexpr std::size_t capacity = 8;
+    constexpr int num_waiters = 64;
+
+    exec::static_thread_pool pool{ 4 };
+    Queue<int, capacity, exec::static_thread_pool::scheduler> queue(pool.get_scheduler());
+    std::atomic<int> join_completions{ 0 };
+
+    ASSERT_TRUE(queue.enqueue(1));
+    ASSERT_TRUE(queue.enqueue(2));
+
+    // Half of the joiners are coroutines, the other half plain threads
+    std::vector<std::thread> waiters;
+    for (int i = 0; i < num_waiters; ++i)
+    {
+        waiters.emplace_back([&, i]() {
+            if (i % 2 == 0)
+            {
+                stdexec::sync_wait(queue.join());
+            }
+            else
+            {
+                queue.join_blocking();
+            }
+            ++join_completions;
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(join_completions.load(), 0);
+
+    EXPECT_EQ(queue.dequeue(), 1);
+    queue.task_done();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(join_completions.load(), 0);
+
+    EXPECT_EQ(queue.dequeue(), 2);
+    queue.task_done();
+
+    for (auto & waiter : waiters)
+    {
+        waiter.join();
+    }
+    EXPECT_EQ(join_completions.load(), num_waiters);
+    EXPECT_THROW(queue.task_done(), abc::abc_error);
+}
+
+TEST(async_queue, join_blocking_returns_immediately_when_nothing_is_pending)
+{
+    using namespace abc::async;
+
+    Queue<int, 4, exec::inline_scheduler> queue(exec::inline_scheduler{});
+    queue.join_blocking();
+
+    ASSERT_TRUE(queue.enqueue(1));
+    EXPECT_EQ(queue.dequeue(), 1);
+    queue.task_done();
+    queue.join_blocking();
+}
+
+TEST(async_queue, parked_consumer_woken_by_sync_enqueue)
+{
+    using namespace abc::async;
+    constexpr std::size_t capacity = 4;
+
+    exec::static_thread_pool pool{ 2 };
+    Queue<int, capacity, exec::static_thread_pool::scheduler> queue(pool.get_scheduler());
+
+    std::thread producer([&queue]() {
+        // Give the consumer time to find the queue empty and park
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_TRUE(queue.enqueue(7));
+    });
+
+    auto consumer = [&]() -> exec::task<int> { co_return co_await queue.async_dequeue(); };
+
+    auto [result] = stdexec::sync_wait(consumer()).value();
+    producer.join();
+
+    EXPECT_EQ(result, 7);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(async_queue, parked_waiters_each_resumed_once)
+{
+    using namespace abc::async;
+    constexpr std::size_t capacity = 2;
+    constexpr int num_items = 64;
+
+    exec::static_thread_pool pool{ 4 };
+    Queue<int, capacity, exec::static_thread_pool::scheduler> queue(pool.get_scheduler());
+
+    std::atomic<int> consumed_sum{ 0 };
+    std::atomic<int> consumed_count{ 0 };
+
+    // More producers than cells and more consumers than items in flight, so both sides park
+    auto producer = [&](int start) -> exec::task<void> {
+        for (int i = start; i < num_items; i += 4)
+        {
+            co_await queue.async_enqueue(i);
+        }
+    };
+
+    auto consumer = [&]() -> exec::task<void> {
+        for (int i = 0; i < num_items / 8; ++i)
+        {
+            consumed_sum += co_await queue.async_dequeue();
+            ++consumed_count;
+        }
+    };
+
+    stdexec::sync_wait(stdexec::when_all(consumer(), consumer(), consumer(), consumer(), consumer(), consumer(), consumer(), consumer(), producer(0), producer(1), producer(2), producer(3)));
+
+    EXPECT_EQ(consumed_count.load(), num_items);
+    EXPECT_EQ(consumed_sum.load(), num_items * (num_items - 1) / 2);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(async_queue, sync_bulk_enqueue_dequeue)
+{
+    using namespace abc::async;
+    constexpr std::size_t capacity = 8;
+
+    Queue<int, capacity, exec::inline_scheduler> queue(exec::inline_scheduler{});
+
+    std::vector<int> input{ 0, 1, 2, 3, 4, 5 };
+    EXPECT_EQ(queue.enqueue_bulk(input), 6);
+    EXPECT_EQ(queue.size(), 6);
+
+    // Only two cells left
+    std::vector<int> more{ 6, 7, 8, 9 };
+    EXPECT_EQ(queue.enqueue_bulk(more), 2);
+    EXPECT_TRUE(queue.full());
+    EXPECT_EQ(queue.enqueue_bulk(std::span<int>{ more }.subspan(2)), 0);
+
+    std::vector<int> output(16, -1);
+    EXPECT_EQ(queue.dequeue_bulk(output, 3), 3);
+    EXPECT_EQ(output[0], 0);
+    EXPECT_EQ(output[1], 1);
+    EXPECT_EQ(output[2], 2);
+    EXPECT_EQ(output[3], -1);
+
+    EXPECT_EQ(queue.dequeue_bulk(output, output.size()), 5);
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(output[i], 3 + i);
+    }
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.dequeue_bulk(output, output.size()), 0);
+
+    // Bulk and single element operations interoperate across the wrap-around
+    EXPECT_TRUE(queue.enqueue(100));
+    EXPECT_EQ(queue.enqueue_bulk(input), 6);
+    EXPECT_EQ(queue.dequeue(), 100);
+    EXPECT_EQ(queue.dequeue_bulk(output, output.size()), 6);
+    for (int i = 0; i < 6; ++i)
+    {
+        EXPECT_EQ(output[i], i);
+    }
+
+    // 6 + 2 + 1 + 6 items went through the queue
+    for (int i = 0; i < 15; ++i)
+    {
+        queue.task_done();
+    }
+    EXPECT_THROW(queue.task_done(), abc::abc_error);
+}
+
+TEST(async_queue, concurrent_bulk_producers_consumers)
+{
+    using namespace abc::async;
+
+    constexpr std::size_t capacity = 1024;
+    constexpr std::size_t num_producers = 4;
+    constexpr std::size_t num_consumers = 4;
+    constexpr std::size_t items_per_producer = 10000;
+    constexpr std::size_t burst = 64;
+
+    exec::static_thread_pool thread_pool{ 4 };
+    stdexec::scheduler auto scheduler = thread_pool.get_scheduler();
+    Queue<std::size_t, capacity, decltype(scheduler)> queue(scheduler);
+    std::atomic<std::size_t> consumed_count{ 0 };
+    std::atomic<std::size_t> consumed_sum{ 0 };
+    std::vector<std::vector<std::size_t>> last_seen(num_consumers, std::vector<std::size_t>(num_producers, 0));
+
+    std::vector<std::thread> producers;
+    for (std::size_t i = 0; i < num_producers; ++i)
+    {
+        producers.emplace_back([&, i]() {
+            std::vector<std::size_t> items(burst);
+            for (std::size_t j = 0; j < items_per_producer; j += burst)
+            {
+                for (std::size_t k = 0; k < burst; ++k)
+                {
+                    // Encode producer id and a 1-based per-producer sequence number
+                    items[k] = i * items_per_producer * 2 + j + k + 1;
+                }
+
+                std::span<std::size_t> pending{ items.data(), std::min(burst, items_per_producer - j) };
+                while (!pending.empty())
+                {
+                    pending = pending.subspan(queue.enqueue_bulk(pending));
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> consumers;
+    for (std::size_t i = 0; i < num_consumers; ++i)
+    {
+        consumers.emplace_back([&, i]() {
+            std::vector<std::size_t> items(burst);
+            while (consumed_count.load() < num_producers * items_per_producer)
+            {
+                std::size_t const count = queue.dequeue_bulk(items, burst);
+                for (std::size_t k = 0; k < count; ++k)
+                {
+                    std::size_t const producer = items[k] / (items_per_producer * 2);
+                    std::size_t const sequence = items[k] % (items_per_producer * 2);
+
+                    // Items of one producer are observed in FIFO order by every consumer
+                    EXPECT_GT(sequence, last_seen[i][producer]);
+                    last_seen[i][producer] = sequence;
+                    consumed_sum += sequence;
+                }
+                consumed_count += count;
+            }
+        });
+    }
+
+    for (auto & producer : producers)
+    {
+        producer.join();
+    }
+    for (auto & consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    EXPECT_EQ(consumed_count.load(), num_producers * items_per_producer);
+    EXPECT_EQ(consumed_sum.load(), num_producers * items_per_producer * (items_per_producer + 1) / 2);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(async_queue, async_bulk_producers_consumers)
+{
+    using namespace abc::async;
+    constexpr std::size_t capacity = 16;
+    constexpr int num_items = 1000;
+    constexpr std::size_t burst = 24;
+
+    exec::static_thread_pool pool{ 4 };
+    Queue<int, capacity, exec::static_thread_pool::scheduler> queue(pool.get_scheduler());
+
+    std::atomic<int> consumed_count{ 0 };
+    std::atomic<long> consumed_sum{ 0 };
+
+    // Bursts larger than the capacity force producers to park part way through a batch
+    auto producer = [&](int start) -> exec::task<void> {
+        std::vector<int> items;
+        for (int i = start; i < start + num_items / 2; ++i)
+        {
+            items.push_back(i);
+            if (items.size() == burst || i == start + num_items / 2 - 1)
+            {
+                co_await queue.async_enqueue_bulk(items);
+                items.clear();
+            }
+        }
+    };
+
+    // Each consumer takes exactly half of the items, asking for no more than it still needs
+    auto consumer = [&]() -> exec::task<void> {
+        std::vector<int> items(burst);
+        std::size_t taken = 0;
+        while (taken < num_items / 2)
+        {
+            std::size_t const count = co_await queue.async_dequeue_bulk(items, num_items / 2 - taken);
+            for (std::size_t k = 0; k < count; ++k)
+            {
+                consumed_sum += items[k];
+            }
+            taken += count;
+            consumed_count += static_cast<int>(count);
+        }
+    };
+
+    stdexec::sync_wait(stdexec::when_all(producer(0), producer(num_items / 2), consumer(), consumer()));
+
+    EXPECT_EQ(consumed_count.load(), num_items);
+    EXPECT_EQ(consumed_sum.load(), static_cast<long>(num_items) * (num_items - 1) / 2);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(async_queue, dequeue_batch_fills_up_without_waiting)
+{
+    using namespace abc::async;
+    using namespace std::chrono_literals;
+
+    exec::static_thread_pool pool{ 2 };
+    Queue<int, 16, exec::static_thread_pool::scheduler> queue(pool.get_scheduler());
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_TRUE(queue.enqueue(i));
+    }
+
+    std::vector<int> items(8);
+    auto const start_time = std::chrono::steady_clock::now();
+    auto [count] = stdexec::sync_wait(queue.async_dequeue_batch(items, 6, 10s)).value();
+    EXPECT_LT(std::chrono::steady_clock::now() - start_time, 1s);
+
+    ASSERT_EQ(count, 6u);
+    for (int i = 0; i < 6; ++i)
+    {
+        EXPECT_EQ(items[i], i);
+    }
+    EXPECT_EQ(queue.size(), 4u);
+
+    // The buffer size caps the batch as well
+    std::vector<int> small(2);
+    auto [small_count] = stdexec::sync_wait(queue.async_dequeue_batch(small, 6, 10s)).value();
+    EXPECT_EQ(small_count, 2u);
+    EXPECT_EQ(small[0], 6);
+    EXPECT_EQ(small[1], 7);
+}
+
+TEST(async_queue, dequeue_batch_flushes_partial_batch_at_deadline)
+{
+    using namespace abc::async;
+    using namespace std::chrono_literals;
+
+    exec::static_thread_pool pool{ 2 };
+    Queue<int, 16, exec::static_thread_pool::scheduler> queue(pool.get_scheduler());
+
+    // The deadline only starts with the first item
+    std::thread producer([&]() {
+        std::this_thread::sleep_for(20ms);
+        for (int i = 0; i < 3; ++i)
+        {
+            EXPECT_TRUE(queue.enqueue(i));
+        }
+    });
+
+    std::vector<int> items(8);
+    auto const start_time = std::chrono::steady_clock::now();
+    auto [count] = stdexec::sync_wait(queue.async_dequeue_batch(items, items.size(), 30ms)).value();
+    auto const elapsed = std::chrono::steady_clock::now() - start_time;
+    producer.join();
+
+    EXPECT_GE(elapsed, 50ms);
+    ASSERT_EQ(count, 3u);
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(items[i], i);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(async_queue, dequeue_batch_wakes_on_arrival_within_the_window)
+{
+    using namespace abc::async;
+    using namespace std::chrono_literals;
+
+    exec::static_thread_pool pool{ 2 };
+    Queue<int, 16, exec::static_thread_pool::scheduler> queue(pool.get_scheduler());
+    ASSERT_TRUE(queue.enqueue(0));
+
+    // The batch is parked, not polling, until the rest arrives well before the deadline
+    std::thread producer([&]() {
+        std::this_thread::sleep_for(20ms);
+        for (int i = 1; i < 4; ++i)
+        {
+            EXPECT_TRUE(queue.enqueue(i));
+        }
+    });
+
+    std::vector<int> items(4);
+    auto const start_time = std::chrono::steady_clock::now();
+    auto [count] = stdexec::sync_wait(queue.async_dequeue_batch(items, items.size(), 10s)).value();
+    auto const elapsed = std::chrono::steady_clock::now() - start_time;
+    producer.join();
+
+    EXPECT_LT(elapsed, 5s);
+    ASSERT_EQ(count, 4u);
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(items[i], i);
+    }
+}
+
+TEST(async_queue, dequeue_batch_coalesces_a_trickle)
+{
+    using namespace abc::async;
+    using namespace std::chrono_literals;
+    constexpr int num_items = 200;
+    constexpr std::size_t batch = 16;
+
+    exec::static_thread_pool pool{ 2 };
+    Queue<int, 64, exec::static_thread_pool::scheduler> queue(pool.get_scheduler());
+
+    std::thread producer([&]() {
+        for (int i = 0; i < num_items; ++i)
+        {
+            while (!queue.enqueue(i))
+            {
+                std::this_thread::yield();
+            }
+            if (i % 8 == 0)
+            {
+                std::this_thread::sleep_for(100us);
+            }
+        }
+    });
+
+    auto consumer = [&]() -> exec::task<int> {
+        std::vector<int> items(batch);
+        int expected = 0;
+        int batches = 0;
+        while (expected < num_items)
+        {
+            std::size_t const count = co_await queue.async_dequeue_batch(items, batch, 5ms);
+            EXPECT_GE(count, 1u);
+            for (std::size_t k = 0; k < count; ++k)
+            {
+                EXPECT_EQ(items[k], expected++);
+            }
+            ++batches;
+        }
+        co_return batches;
+    };
+
+    auto [batches] = stdexec::sync_wait(consumer()).value();
+    producer.join();
+
+    // Items trickling in within the window share a batch
+    EXPECT_LT(batches, num_items / 2);
+    EXPECT_TRUE(queue.empty());
+}
+
+namespace
+{
+
+template <abc::async::QueueCardinality CardinalityV, abc::async::QueueCellLayout LayoutV = abc::async::QueueCellLayout::Packed>
+void
+run_cardinality_round_trip(std::size_t const num_producers, std::size_t const num_consumers)
+{
+    using namespace abc::async;
+
+    constexpr std::size_t capacity = 64;
+    constexpr std::size_t items_per_producer = 5000;
+
+    exec::static_thread_pool thread_pool{ 2 };
+    stdexec::scheduler auto scheduler = thread_pool.get_scheduler();
+    Queue<std::size_t, capacity, decltype(scheduler), CardinalityV, LayoutV> queue(scheduler);
+    std::atomic<std::size_t> consumed_count{ 0 };
+    std::atomic<std::size_t> consumed_sum{ 0 };
+
+    std::vector<std::thread> producers;
+    for (std::size_t i = 0; i < num_producers; ++i)
+    {
+        producers.emplace_back([&, i]() {
+            for (std::size_t j = 1; j <= items_per_producer; ++j)
+            {
+                // Alternate single and bulk operations
+                std::size_t item = i * items_per_producer * 2 + j;
+                if (j % 2 == 0)
+                {
+                    while (!queue.enqueue(item))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+                else
+                {
+                    while (queue.enqueue_bulk(std::span<std::size_t>{ &item, 1 }) == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> consumers;
+    for (std::size_t i = 0; i < num_consumers; ++i)
+    {
+        consumers.emplace_back([&]() {
+            std::vector<std::size_t> last_seen(num_producers, 0);
+            std::vector<std::size_t> items(8);
+            while (consumed_count.load() < num_producers * items_per_producer)
+            {
+                std::size_t const count = queue.dequeue_bulk(items, items.size());
+                if (count == 0)
+                {
+                    std::this_thread::yield();
+                }
+                for (std::size_t k = 0; k < count; ++k)
+                {
+                    std::size_t const producer = items[k] / (items_per_producer * 2);
+                    std::size_t const sequence = items[k] % (items_per_producer * 2);
+                    EXPECT_GT(sequence, last_seen[producer]);
+                    last_seen[producer] = sequence;
+                    consumed_sum += sequence;
+                }
+                consumed_count += count;
+            }
+        });
+    }
+
+    for (auto & producer : producers)
+    {
+        producer.join();
+    }
+    for (auto & consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    EXPECT_EQ(consumed_count.load(), num_producers * items_per_producer);
+    EXPECT_EQ(consumed_sum.load(), num_producers * items_per_producer * (items_per_producer + 1) / 2);
+    EXPECT_TRUE(queue.empty());
+}
+
+} // namespace
+
+TEST(async_queue, spsc_round_trip)
+{
+    run_cardinality_round_trip<abc::async::QueueCardinality::Spsc>(1, 1);
+}
+
+TEST(async_queue, mpsc_round_trip)
+{
+    run_cardinality_round_trip<abc::async::QueueCardinality::Mpsc>(4, 1);
+}
+
+TEST(async_queue, spmc_round_trip)
+{
+    run_cardinality_round_trip<abc::async::QueueCardinality::Spmc>(1, 4);
+}
+
+TEST(async_queue, spsc_sync_boundary_conditions)
+{
+    using namespace abc::async;
+
+    constexpr std::size_t capacity = 4;
+    SpscQueue<int, capacity, exec::inline_scheduler> queue(exec::inline_scheduler{});
+
+    for (int round = 0; round < 3; ++round)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(queue.enqueue(i));
+        }
+        EXPECT_TRUE(queue.full());
+        EXPECT_FALSE(queue.enqueue(4));
+
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_EQ(queue.dequeue(), i);
+            queue.task_done();
+        }
+        EXPECT_TRUE(queue.empty());
+        EXPECT_FALSE(queue.dequeue().has_value());
+    }
+
+    EXPECT_THROW(queue.task_done(), abc::abc_error);
+}
+
+TEST(async_queue, spsc_async_backpressure)
+{
+    using namespace abc::async;
+    constexpr std::size_t capacity = 4;
+    constexpr int num_items = 1000;
+
+    exec::static_thread_pool pool{ 2 };
+    SpscQueue<int, capacity, exec::static_thread_pool::scheduler> queue(pool.get_scheduler());
+
+    auto producer = [&]() -> exec::task<void> {
+        for (int i = 0; i < num_items; ++i)
+        {
+            co_await queue.async_enqueue(i);
+        }
+    };
+
+    auto consumer = [&]() -> exec::task<void> {
+        for (int i = 0; i < num_items; ++i)
+        {
+            EXPECT_EQ(co_await queue.async_dequeue(), i);
+            queue.task_done();
+        }
+    };
+
+    stdexec::sync_wait(stdexec::when_all(producer(), consumer(), queue.join()));
+
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(async_queue, dynamic_capacity_sync_enqueue_dequeue)
+{
+    using namespace abc::async;
+
+    DynamicQueue<int, exec::inline_scheduler> queue(exec::inline_scheduler{}, 8);
+    EXPECT_EQ(queue.capacity(), 8);
+
+    for (int round = 0; round < 3; ++round)
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            EXPECT_TRUE(queue.enqueue(i));
+        }
+        EXPECT_TRUE(queue.full());
+        EXPECT_FALSE(queue.enqueue(8));
+
+        for (int i = 0; i < 8; ++i)
+        {
+            EXPECT_EQ(queue.dequeue(), i);
+        }
+        EXPECT_TRUE(queue.empty());
+    }
+}
+
+TEST(async_queue, dynamic_capacity_must_be_power_of_two)
+{
+    using namespace abc::async;
+
+    EXPECT_THROW((DynamicQueue<int, exec::inline_scheduler>(exec::inline_scheduler{}, 0)), abc::abc_error);
+    EXPECT_THROW((DynamicQueue<int, exec::inline_scheduler>(exec::inline_scheduler{}, 12)), abc::abc_error);
+
+    try
+    {
+        DynamicQueue<int, exec::inline_scheduler> queue(exec::inline_scheduler{}, 3);
+        FAIL() << "Expected abc::abc_error to be thrown";
+    }
+    catch (abc::abc_error const & e)
+    {
+        EXPECT_EQ(e.code(), abc::make_error_code(abc::errc::invalid_queue_capacity));
+    }
+}
+
+TEST(async_queue, dynamic_capacity_large_non_trivial_items)
+{
+    using namespace abc::async;
+    constexpr std::size_t capacity = 1 << 16;
+    constexpr std::size_t overflow = 16;
+
+    exec::static_thread_pool pool{ 2 };
+    DynamicQueue<std::string, exec::static_thread_pool::scheduler> queue(pool.get_scheduler(), capacity);
+    EXPECT_EQ(queue.capacity(), capacity);
+
+    for (std::size_t i = 0; i < capacity; ++i)
+    {
+        ASSERT_TRUE(queue.enqueue(std::to_string(i)));
+    }
+    EXPECT_TRUE(queue.full());
+
+    // The producer parks until the consumer starts draining
+    auto producer = [&]() -> exec::task<void> {
+        for (std::size_t i = capacity; i < capacity + overflow; ++i)
+        {
+            co_await queue.async_enqueue(std::to_string(i));
+        }
+    };
+
+    auto consumer = [&]() -> exec::task<void> {
+        std::vector<std::string> items(1024);
+        std::size_t next = 0;
+        while (next < capacity + overflow)
+        {
+            std::size_t const count = co_await queue.async_dequeue_bulk(items, items.size());
+            for (std::size_t k = 0; k < count; ++k)
+            {
+                EXPECT_EQ(items[k], std::to_string(next++));
+            }
+        }
+    };
+
+    stdexec::sync_wait(stdexec::when_all(producer(), consumer()));
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(async_queue, dynamic_capacity_spsc_round_trip)
+{
+    using namespace abc::async;
+    constexpr int num_items = 100000;
+
+    exec::static_thread_pool pool{ 2 };
+    DynamicQueue<int, exec::static_thread_pool::scheduler, QueueCardinality::Spsc> queue(pool.get_scheduler(), 1024);
+
+    std::thread producer([&queue]() {
+        for (int i = 0; i < num_items; ++i)
+        {
+            while (!queue.enqueue(i))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    for (int i = 0; i < num_items; ++i)
+    {
+        std::optional<int> item;
+        while (!(item = queue.dequeue()))
+        {
+            std::this_thread::yield();
+        }
+        EXPECT_EQ(*item, i);
+    }
+    producer.join();
+
+    EXPECT_TRUE(queue.empty());
+}
+
+namespace
+{
+
+// Counts the special member calls made on it
+struct Tracked
+{
+    static inline int constructions = 0;
+    static inline int copies = 0;
+    static inline int moves = 0;
+    static inline int destructions = 0;
+
+    static auto reset() -> void
+    {
+        constructions = copies = moves = destructions = 0;
+    }
+
+    Tracked(int v, std::string s) noexcept : value{ v }, text{ std::move(s) }
+    {
+        ++constructions;
+    }
+
+    Tracked(Tracked const & other) : value{ other.value }, text{ other.text }
+    {
+        ++copies;
+    }
+
+    Tracked(Tracked && other) noexcept : value{ other.value }, text{ std::move(other.text) }
+    {
+        ++moves;
+    }
+
+    auto operator=(Tracked const &) -> Tracked & = default;
+    auto operator=(Tracked &&) -> Tracked & = default;
+
+    ~Tracked()
+    {
+        ++destructions;
+    }
+
+    int value;
+    std::string text;
+};
+
+} // namespace
+
+TEST(async_queue, emplace_and_consume_in_place)
+{
+    using namespace abc::async;
+
+    static_assert(!std::is_default_constructible_v<Tracked>);
+    Tracked::reset();
+    {
+        Queue<Tracked, 4, exec::inline_scheduler> queue(exec::inline_scheduler{});
+
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(queue.try_emplace(i, std::to_string(i)));
+        }
+        EXPECT_FALSE(queue.try_emplace(4, std::to_string(4)));
+        EXPECT_EQ(Tracked::constructions, 4);
+
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(queue.try_consume([i](Tracked & item) {
+                EXPECT_EQ(item.value, i);
+                EXPECT_EQ(item.text, std::to_string(i));
+            }));
+        }
+        EXPECT_FALSE(queue.try_consume([](Tracked &) { FAIL(); }));
+
+        // Nothing was moved or copied on the way through, and every item was destroyed in the queue
+        EXPECT_EQ(Tracked::copies, 0);
+        EXPECT_EQ(Tracked::moves, 0);
+        EXPECT_EQ(Tracked::destructions, 4);
+    }
+    EXPECT_EQ(Tracked::destructions, 4);
+}
+
+TEST(async_queue, non_default_constructible_round_trip)
+{
+    using namespace abc::async;
+
+    Tracked::reset();
+    {
+        MpscQueue<Tracked, 2, exec::inline_scheduler> queue(exec::inline_scheduler{});
+
+        Tracked item{ 7, "seven" };
+        EXPECT_TRUE(queue.enqueue(item));
+        EXPECT_TRUE(queue.enqueue(Tracked{ 8, "eight" }));
+
+        // A failed enqueue leaves the argument untouched
+        Tracked rejected{ 9, "nine" };
+        EXPECT_FALSE(queue.enqueue(std::move(rejected)));
+        EXPECT_EQ(rejected.text, "nine");
+
+        auto first = queue.dequeue();
+        ASSERT_TRUE(first.has_value());
+        EXPECT_EQ(first->value, 7);
+        EXPECT_EQ(first->text, "seven");
+
+        auto second = stdexec::sync_wait(queue.async_dequeue());
+        ASSERT_TRUE(second.has_value());
+        EXPECT_EQ(std::get<0>(*second).text, "eight");
+    }
+}
+
+TEST(async_queue, destructor_destroys_remaining_items)
+{
+    using namespace abc::async;
+
+    Tracked::reset();
+    {
+        SpscQueue<Tracked, 8, exec::inline_scheduler> queue(exec::inline_scheduler{});
+        for (int i = 0; i < 6; ++i)
+        {
+            EXPECT_TRUE(queue.try_emplace(i, std::string{ "item" }));
+        }
+        EXPECT_TRUE(queue.try_consume([](Tracked &) {}));
+        EXPECT_TRUE(queue.try_consume([](Tracked &) {}));
+        EXPECT_EQ(Tracked::destructions, 2);
+    }
+    EXPECT_EQ(Tracked::destructions, Tracked::constructions + Tracked::copies + Tracked::moves);
+    EXPECT_EQ(Tracked::destructions, 6);
+}
+
+TEST(async_queue, throwing_consumer_still_releases_the_cell)
+{
+    using namespace abc::async;
+
+    Queue<std::string, 2, exec::inline_scheduler> queue(exec::inline_scheduler{});
+    EXPECT_TRUE(queue.enqueue("first"));
+    EXPECT_TRUE(queue.enqueue("second"));
+    EXPECT_TRUE(queue.full());
+
+    EXPECT_THROW(queue.try_consume([](std::string &) { throw std::runtime_error("consumer failed"); }), std::runtime_error);
+
+    // The item counts as dequeued and its cell is free again
+    EXPECT_EQ(queue.size(), 1);
+    EXPECT_TRUE(queue.enqueue("third"));
+    EXPECT_EQ(queue.dequeue(), "second");
+    EXPECT_EQ(queue.dequeue(), "third");
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(async_queue, padded_layout_round_trip)
+{
+    using namespace abc::async;
+
+    // Every cell takes a whole cache line
+    static_assert(sizeof(Queue<int, 64, exec::inline_scheduler, QueueCardinality::Mpmc, QueueCellLayout::Padded>) >= 64 * 64);
+
+    run_cardinality_round_trip<QueueCardinality::Mpmc, QueueCellLayout::Padded>(2, 2);
+    run_cardinality_round_trip<QueueCardinality::Spsc, QueueCellLayout::Padded>(1, 1);
+}
+
+TEST(async_queue, remapped_layout_round_trip)
+{
+    using namespace abc::async;
+
+    // Remapping moves cells around without growing them
+    static_assert(sizeof(Queue<int, 64, exec::inline_scheduler, QueueCardinality::Mpmc, QueueCellLayout::Remapped>) ==
+                  sizeof(Queue<int, 64, exec::inline_scheduler, QueueCardinality::Mpmc, QueueCellLayout::Packed>));
+
+    run_cardinality_round_trip<QueueCardinality::Mpmc, QueueCellLayout::Remapped>(2, 2);
+    run_cardinality_round_trip<QueueCardinality::Spsc, QueueCellLayout::Remapped>(1, 1);
+}
+
+TEST(async_queue, remapped_layout_preserves_fifo_order)
+{
+    using namespace abc::async;
+
+    // Smaller than, equal to and larger than a cache line worth of cells
+    Queue<int, 2, exec::inline_scheduler, QueueCardinality::Mpmc, QueueCellLayout::Remapped> tiny(exec::inline_scheduler{});
+    Queue<int, 4, exec::inline_scheduler, QueueCardinality::Mpmc, QueueCellLayout::Remapped> line(exec::inline_scheduler{});
+    DynamicQueue<int, exec::inline_scheduler, QueueCardinality::Spsc, QueueCellLayout::Remapped> ring(exec::inline_scheduler{}, 256);
+
+    auto check = [](auto & queue) {
+        for (int round = 0; round < 3; ++round)
+        {
+            int const base = round * 1000;
+            for (int i = 0; i < static_cast<int>(queue.capacity()); ++i)
+            {
+                EXPECT_TRUE(queue.enqueue(base + i));
+            }
+            EXPECT_TRUE(queue.full());
+            for (int i = 0; i < static_cast<int>(queue.capacity()); ++i)
+            {
+                EXPECT_EQ(queue.dequeue(), base + i);
+            }
+            EXPECT_TRUE(queue.empty());
+        }
+    };
+    check(tiny);
+    check(line);
+    check(ring);
+}
+
+namespace
+{
+
+// Receiver recording how an operation completed
+template <typename... Values>
+struct RecordingReceiver
+{
+    using receiver_concept = stdexec::receiver_t;
+
+    std::optional<std::tuple<Values...>> * values;
+    std::thread::id * completed_on;
+    std::atomic<bool> * done{ nullptr };
+
+    auto
+    set_value(Values... v) noexcept -> void
+    {
+        values->emplace(std::move(v)...);
+        *completed_on = std::this_thread::get_id();
+        if (done != nullptr)
+        {
+            done->store(true, std::memory_order_release);
+        }
+    }
+
+    auto
+    set_error(std::exception_ptr) noexcept -> void
+    {
+        ADD_FAILURE() << "unexpected error";
+    }
+
+    auto
+    set_stopped() noexcept -> void
+    {
+        ADD_FAILURE() << "unexpected stop";
+    }
+
+    auto
+    get_env() const noexcept -> stdexec::env<>
+    {
+        return {};
+    }
+};
+
+} // namespace
+
+TEST(async_queue, senders_complete_inline_on_fast_path)
+{
+    using namespace abc::async;
+
+    // A thread pool scheduler: any hop would complete on one of its threads
+    exec::static_thread_pool pool{ 1 };
+    Queue<std::string, 2, exec::static_thread_pool::scheduler> queue(pool.get_scheduler());
+
+    std::optional<std::tuple<>> enqueued;
+    std::thread::id enqueued_on;
+    auto enqueue_op = stdexec::connect(queue.enqueue_sender("item"), RecordingReceiver<>{ &enqueued, &enqueued_on });
+    stdexec::start(enqueue_op);
+    EXPECT_TRUE(enqueued.has_value());
+    EXPECT_EQ(enqueued_on, std::this_thread::get_id());
+
+    std::optional<std::tuple<std::string>> dequeued;
+    std::thread::id dequeued_on;
+    auto dequeue_op = stdexec::connect(queue.dequeue_sender(), RecordingReceiver<std::string>{ &dequeued, &dequeued_on });
+    stdexec::start(dequeue_op);
+    ASSERT_TRUE(dequeued.has_value());
+    EXPECT_EQ(std::get<0>(*dequeued), "item");
+    EXPECT_EQ(dequeued_on, std::this_thread::get_id());
+}
+
+TEST(async_queue, senders_wait_and_resume_through_scheduler)
+{
+    using namespace abc::async;
+
+    exec::static_thread_pool pool{ 1 };
+    Queue<int, 2, exec::static_thread_pool::scheduler> queue(pool.get_scheduler());
+
+    // Nothing to dequeue: the operation parks instead of completing
+    std::optional<std::tuple<int>> dequeued;
+    std::thread::id dequeued_on;
+    std::atomic<bool> done{ false };
+    auto dequeue_op = stdexec::connect(queue.dequeue_sender(), RecordingReceiver<int>{ &dequeued, &dequeued_on, &done });
+    stdexec::start(dequeue_op);
+    EXPECT_FALSE(done.load());
+
+    // An enqueue hands the item over and the dequeue completes on the pool
+    EXPECT_TRUE(queue.enqueue(42));
+    while (!done.load(std::memory_order_acquire))
+    {
+        std::this_thread::yield();
+    }
+    ASSERT_TRUE(dequeued.has_value());
+    EXPECT_EQ(std::get<0>(*dequeued), 42);
+    EXPECT_NE(dequeued_on, std::this_thread::get_id());
+}
+
+TEST(async_queue, senders_round_trip_with_backpressure)
+{
+    using namespace abc::async;
+    constexpr int num_items = 1000;
+
+    exec::static_thread_pool pool{ 2 };
+    Queue<int, 4, exec::static_thread_pool::scheduler> queue(pool.get_scheduler());
+
+    auto producer = [&]() -> exec::task<void> {
+        for (int i = 0; i < num_items; ++i)
+        {
+            co_await queue.enqueue_sender(i);
+        }
+    };
+
+    auto consumer = [&]() -> exec::task<void> {
+        for (int i = 0; i < num_items; ++i)
+        {
+            EXPECT_EQ(co_await queue.dequeue_sender(), i);
+        }
+    };
+
+    stdexec::sync_wait(stdexec::when_all(consumer(), producer()));
+    EXPECT_TRUE(queue.empty());
+}
+
+namespace
+{
+
+// Constructor that may throw, move that does not
+struct Picky
+{
+    explicit Picky(int v) : value{ v }
+    {
+        if (v < 0)
+        {
+            throw std::invalid_argument("negative");
+        }
+    }
+
+    Picky(Picky &&) noexcept = default;
+
+    int value;
+};
+
+} // namespace
+
+TEST(async_queue, throwing_constructor_leaves_no_hole)
+{
+    using namespace abc::async;
+
+    Queue<Picky, 4, exec::inline_scheduler> queue(exec::inline_scheduler{});
+    EXPECT_TRUE(queue.try_emplace(1));
+    EXPECT_THROW(queue.try_emplace(-1), std::invalid_argument);
+    EXPECT_TRUE(queue.try_emplace(2));
+    EXPECT_EQ(queue.size(), 2u);
+
+    // The failed item never took a cell or a task_done() slot
+    EXPECT_EQ(queue.dequeue()->value, 1);
+    EXPECT_EQ(queue.dequeue()->value, 2);
+    EXPECT_FALSE(queue.dequeue().has_value());
+    queue.task_done();
+    queue.task_done();
+    queue.join_blocking();
+}
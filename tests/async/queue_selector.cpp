@@ -0,0 +1,158 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <abc/async/queue_selector.h>
+
+#include <exec/inline_scheduler.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(async_queue_selector, try_select_drains_in_priority_order)
+{
+    using namespace abc::async;
+
+    Queue<int, 16, exec::inline_scheduler> control(exec::inline_scheduler{});
+    Queue<std::string, 16, exec::inline_scheduler> data(exec::inline_scheduler{});
+
+    EXPECT_FALSE(try_select(control, data).has_value());
+
+    EXPECT_TRUE(data.enqueue(std::string{ "a" }));
+    EXPECT_TRUE(data.enqueue(std::string{ "b" }));
+    EXPECT_TRUE(control.enqueue(1));
+    EXPECT_TRUE(control.enqueue(2));
+
+    auto first = try_select(control, data);
+    ASSERT_TRUE(first.has_value());
+    ASSERT_EQ(first->index(), 0u);
+    EXPECT_EQ(std::get<0>(*first), 1);
+    EXPECT_EQ(std::get<0>(*try_select(control, data)), 2);
+    EXPECT_EQ(std::get<1>(*try_select(control, data)), "a");
+    EXPECT_EQ(std::get<1>(*try_select(control, data)), "b");
+    EXPECT_FALSE(try_select(control, data).has_value());
+}
+
+TEST(async_queue_selector, round_robin_alternates_between_queues)
+{
+    using namespace abc::async;
+    using IntQueue = Queue<int, 16, exec::inline_scheduler>;
+
+    IntQueue a(exec::inline_scheduler{});
+    IntQueue b(exec::inline_scheduler{});
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(a.enqueue(i));
+        EXPECT_TRUE(b.enqueue(10 + i));
+    }
+    EXPECT_TRUE(a.enqueue(3));
+
+    QueueSelector<SelectOrder::RoundRobin, IntQueue, IntQueue> selector{ a, b };
+    std::vector<std::size_t> sources;
+    while (auto result = selector.try_select())
+    {
+        sources.push_back(result->index());
+    }
+    EXPECT_EQ(sources, (std::vector<std::size_t>{ 0, 1, 0, 1, 0, 1, 0 }));
+}
+
+TEST(async_queue_selector, async_select_resumes_on_the_queue_that_receives_an_item)
+{
+    using namespace abc::async;
+    using namespace std::chrono_literals;
+
+    exec::static_thread_pool pool{ 2 };
+    using IntQueue = Queue<int, 16, exec::static_thread_pool::scheduler>;
+    IntQueue control(pool.get_scheduler());
+    IntQueue data(pool.get_scheduler());
+
+    for (std::size_t target = 0; target < 2; ++target)
+    {
+        std::thread producer{ [&]() {
+            std::this_thread::sleep_for(10ms);
+            EXPECT_TRUE((target == 0 ? control : data).enqueue(42));
+        } };
+
+        auto [result] = stdexec::sync_wait(async_select(control, data)).value();
+        producer.join();
+
+        EXPECT_EQ(result.index(), target);
+        EXPECT_EQ(target == 0 ? std::get<0>(result) : std::get<1>(result), 42);
+    }
+}
+
+TEST(async_queue_selector, control_queue_overtakes_queued_data)
+{
+    using namespace abc::async;
+
+    exec::static_thread_pool pool{ 2 };
+    using IntQueue = Queue<int, 256, exec::static_thread_pool::scheduler>;
+    IntQueue control(pool.get_scheduler());
+    IntQueue data(pool.get_scheduler());
+
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_TRUE(data.enqueue(i));
+    }
+
+    auto consumer = [&]() -> exec::task<void> {
+        QueueSelector<SelectOrder::Priority, IntQueue, IntQueue> selector{ control, data };
+        for (int i = 0; i < 10; ++i)
+        {
+            auto result = co_await selector.async_select();
+            EXPECT_EQ(result.index(), 1u);
+        }
+
+        // Control items arriving now are served before the 90 queued data items
+        EXPECT_TRUE(control.enqueue(-1));
+        EXPECT_TRUE(control.enqueue(-2));
+        EXPECT_EQ(std::get<0>(co_await selector.async_select()), -1);
+        EXPECT_EQ(std::get<0>(co_await selector.async_select()), -2);
+        EXPECT_EQ(std::get<1>(co_await selector.async_select()), 10);
+    };
+
+    stdexec::sync_wait(consumer());
+}
+
+TEST(async_queue_selector, no_wakeup_is_lost_with_many_selectors)
+{
+    using namespace abc::async;
+    constexpr int num_consumers = 4;
+    constexpr int num_items = 20000;
+
+    exec::static_thread_pool pool{ 4 };
+    using IntQueue = Queue<int, 64, exec::static_thread_pool::scheduler>;
+    IntQueue control(pool.get_scheduler());
+    IntQueue data(pool.get_scheduler());
+    std::atomic<long> consumed_sum{ 0 };
+    std::atomic<int> consumed{ 0 };
+
+    // Every consumer takes its share; items alternate between the two queues
+    auto consumer = [&]() -> exec::task<void> {
+        QueueSelector<SelectOrder::RoundRobin, IntQueue, IntQueue> selector{ control, data };
+        for (int i = 0; i < num_items / num_consumers; ++i)
+        {
+            auto result = co_await selector.async_select();
+            consumed_sum += result.index() == 0 ? std::get<0>(result) : std::get<1>(result);
+            ++consumed;
+        }
+    };
+
+    auto producer = [&]() -> exec::task<void> {
+        for (int i = 0; i < num_items; ++i)
+        {
+            co_await (i % 2 == 0 ? control : data).async_enqueue(i);
+        }
+    };
+
+    stdexec::sync_wait(stdexec::when_all(consumer(), consumer(), consumer(), consumer(), producer()));
+
+    EXPECT_EQ(consumed.load(), num_items);
+    EXPECT_EQ(consumed_sum.load(), static_cast<long>(num_items) * (num_items - 1) / 2);
+    EXPECT_TRUE(control.empty());
+    EXPECT_TRUE(data.empty());
+}
@@ -0,0 +1,395 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <abc/async/segmented_queue.h>
+
+#include <exec/inline_scheduler.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(async_segmented_queue, sync_enqueue_dequeue_across_segments)
+{
+    using namespace abc::async;
+
+    SegmentedQueue<std::string, 4, exec::inline_scheduler> queue(exec::inline_scheduler{});
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.dequeue().has_value());
+
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_TRUE(queue.enqueue(std::to_string(i)));
+        EXPECT_EQ(queue.size(), static_cast<std::size_t>(i + 1));
+    }
+
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(queue.dequeue(), std::to_string(i));
+    }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.dequeue().has_value());
+}
+
+TEST(async_segmented_queue, drained_segments_are_recycled)
+{
+    using namespace abc::async;
+    constexpr std::size_t segment_capacity = 8;
+    constexpr std::size_t burst = 1000;
+
+    SegmentedQueue<int, segment_capacity, exec::inline_scheduler> queue(exec::inline_scheduler{});
+
+    // A steady trickle keeps reusing the same couple of segments
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_TRUE(queue.enqueue(i));
+        EXPECT_EQ(queue.dequeue(), i);
+    }
+    EXPECT_LE(queue.segment_count(), 3u);
+
+    // A burst grows the chain, a second burst of the same size is served from the free-list
+    for (int round = 0; round < 2; ++round)
+    {
+        for (std::size_t i = 0; i < burst; ++i)
+        {
+            EXPECT_TRUE(queue.enqueue(static_cast<int>(i)));
+        }
+        for (std::size_t i = 0; i < burst; ++i)
+        {
+            EXPECT_EQ(queue.dequeue(), static_cast<int>(i));
+        }
+    }
+    EXPECT_GE(queue.segment_count(), burst / segment_capacity);
+    EXPECT_LE(queue.segment_count(), burst / segment_capacity + 3);
+}
+
+TEST(async_segmented_queue, soft_limit_sync)
+{
+    using namespace abc::async;
+
+    SegmentedQueue<int, 4, exec::inline_scheduler> queue(exec::inline_scheduler{}, 6);
+    EXPECT_EQ(queue.soft_limit(), 6u);
+
+    for (int i = 0; i < 6; ++i)
+    {
+        EXPECT_TRUE(queue.enqueue(i));
+    }
+    EXPECT_FALSE(queue.enqueue(6));
+    EXPECT_EQ(queue.size(), 6u);
+
+    EXPECT_EQ(queue.dequeue(), 0);
+    EXPECT_TRUE(queue.enqueue(6));
+    EXPECT_FALSE(queue.enqueue(7));
+}
+
+TEST(async_segmented_queue, soft_limit_async_backpressure)
+{
+    using namespace abc::async;
+    constexpr int num_items = 1000;
+
+    exec::static_thread_pool pool{ 2 };
+    SegmentedQueue<int, 4, exec::static_thread_pool::scheduler> queue(pool.get_scheduler(), 8);
+    std::atomic<std::size_t> max_size{ 0 };
+
+    auto producer = [&]() -> exec::task<void> {
+        for (int i = 0; i < num_items; ++i)
+        {
+            co_await queue.async_enqueue(i);
+        }
+    };
+
+    auto consumer = [&]() -> exec::task<void> {
+        for (int i = 0; i < num_items; ++i)
+        {
+            std::size_t const size = queue.size();
+            if (size > max_size.load())
+            {
+                max_size = size;
+            }
+            EXPECT_EQ(co_await queue.async_dequeue(), i);
+            queue.task_done();
+        }
+    };
+
+    stdexec::sync_wait(stdexec::when_all(producer(), consumer(), queue.join()));
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_LE(max_size.load(), 8u);
+}
+
+TEST(async_segmented_queue, concurrent_producers_consumers)
+{
+    using namespace abc::async;
+    constexpr std::size_t num_producers = 4;
+    constexpr std::size_t num_consumers = 4;
+    constexpr std::size_t items_per_producer = 5000;
+
+    SegmentedQueue<std::size_t, 16, exec::inline_scheduler> queue(exec::inline_scheduler{});
+    std::atomic<std::size_t> consumed_count{ 0 };
+    std::atomic<std::size_t> consumed_sum{ 0 };
+
+    std::vector<std::thread> producers;
+    for (std::size_t i = 0; i < num_producers; ++i)
+    {
+        producers.emplace_back([&, i]() {
+            for (std::size_t j = 1; j <= items_per_producer; ++j)
+            {
+                EXPECT_TRUE(queue.enqueue(i * items_per_producer * 2 + j));
+            }
+        });
+    }
+
+    std::vector<std::thread> consumers;
+    for (std::size_t i = 0; i < num_consumers; ++i)
+    {
+        consumers.emplace_back([&]() {
+            std::vector<std::size_t> last_seen(num_producers, 0);
+            while (consumed_count.load() < num_producers * items_per_producer)
+            {
+                auto item = queue.dequeue();
+                if (!item)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                // Items of one producer are seen in order
+                std::size_t const producer = *item / (items_per_producer * 2);
+                std::size_t const sequence = *item % (items_per_producer * 2);
+                EXPECT_GT(sequence, last_seen[producer]);
+                last_seen[producer] = sequence;
+                consumed_sum += sequence;
+                ++consumed_count;
+            }
+        });
+    }
+
+    for (auto & producer : producers)
+    {
+        producer.join();
+    }
+    for (auto & consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    EXPECT_EQ(consumed_count.load(), num_producers * items_per_producer);
+    EXPECT_EQ(consumed_sum.load(), num_producers * items_per_producer * (items_per_producer + 1) / 2);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(async_segmented_queue, producers_stalled_on_the_segment_lock_survive_recycling)
+{
+    using namespace abc::async;
+    constexpr std::size_t num_producers = 8;
+    constexpr std::size_t num_consumers = 2;
+    constexpr std::size_t items_per_producer = 20000;
+
+    // One-cell segments and a small limit: every item links, drains and recycles a segment under
+    // the mutex, so producers keep waiting on it while the segment they read is reused as a newer
+    // tail. A producer linking at a stale base would leave all of them spinning.
+    SegmentedQueue<std::size_t, 1, exec::inline_scheduler> queue(exec::inline_scheduler{}, 4);
+    std::atomic<std::size_t> consumed_count{ 0 };
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < num_producers; ++i)
+    {
+        threads.emplace_back([&]() {
+            for (std::size_t j = 0; j < items_per_producer; ++j)
+            {
+                while (!queue.enqueue(j))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::size_t i = 0; i < num_consumers; ++i)
+    {
+        threads.emplace_back([&]() {
+            while (consumed_count.load() < num_producers * items_per_producer)
+            {
+                if (!queue.dequeue())
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                ++consumed_count;
+            }
+        });
+    }
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(consumed_count.load(), num_producers * items_per_producer);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(async_segmented_queue, async_producers_consumers)
+{
+    using namespace abc::async;
+    constexpr int num_items = 2000;
+
+    exec::static_thread_pool pool{ 2 };
+    SegmentedQueue<int, 8, exec::static_thread_pool::scheduler> queue(pool.get_scheduler());
+    std::atomic<long> consumed_sum{ 0 };
+
+    auto producer = [&](int first) -> exec::task<void> {
+        for (int i = first; i < num_items; i += 2)
+        {
+            co_await queue.async_enqueue(i);
+        }
+    };
+
+    auto consumer = [&]() -> exec::task<void> {
+        for (int i = 0; i < num_items / 2; ++i)
+        {
+            consumed_sum += co_await queue.async_dequeue();
+            queue.task_done();
+        }
+    };
+
+    stdexec::sync_wait(stdexec::when_all(consumer(), consumer(), producer(0), producer(1), queue.join()));
+
+    EXPECT_EQ(consumed_sum.load(), static_cast<long>(num_items) * (num_items - 1) / 2);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(async_segmented_queue, destructor_destroys_remaining_items)
+{
+    using namespace abc::async;
+
+    auto const tracker = std::make_shared<int>(0);
+    {
+        SegmentedQueue<std::shared_ptr<int>, 4, exec::inline_scheduler> queue(exec::inline_scheduler{});
+        for (int i = 0; i < 10; ++i)
+        {
+            EXPECT_TRUE(queue.enqueue(tracker));
+        }
+        EXPECT_TRUE(queue.dequeue().has_value());
+        EXPECT_EQ(tracker.use_count(), 10);
+    }
+    EXPECT_EQ(tracker.use_count(), 1);
+}
+
+TEST(async_segmented_queue, senders_round_trip_with_backpressure)
+{
+    using namespace abc::async;
+    constexpr int num_items = 1000;
+
+    exec::static_thread_pool pool{ 2 };
+    SegmentedQueue<int, 4, exec::static_thread_pool::scheduler> queue(pool.get_scheduler(), 8);
+
+    auto producer = [&]() -> exec::task<void> {
+        for (int i = 0; i < num_items; ++i)
+        {
+            co_await queue.enqueue_sender(i);
+        }
+    };
+
+    auto consumer = [&]() -> exec::task<void> {
+        for (int i = 0; i < num_items; ++i)
+        {
+            EXPECT_EQ(co_await queue.dequeue_sender(), i);
+        }
+    };
+
+    stdexec::sync_wait(stdexec::when_all(consumer(), producer()));
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(async_segmented_queue, join_waiters_resumed_by_last_task_done)
+{
+    using namespace abc::async;
+    constexpr int num_items = 100;
+    constexpr int num_waiters = 16;
+
+    exec::static_thread_pool pool{ 2 };
+    SegmentedQueue<int, 8, exec::static_thread_pool::scheduler> queue(pool.get_scheduler());
+    std::atomic<int> join_completions{ 0 };
+
+    for (int i = 0; i < num_items; ++i)
+    {
+        ASSERT_TRUE(queue.enqueue(i));
+    }
+
+    std::vector<std::thread> waiters;
+    for (int i = 0; i < num_waiters; ++i)
+    {
+        waiters.emplace_back([&, i]() {
+            if (i % 2 == 0)
+            {
+                stdexec::sync_wait(queue.join());
+            }
+            else
+            {
+                queue.join_blocking();
+            }
+            ++join_completions;
+        });
+    }
+
+    for (int i = 0; i < num_items; ++i)
+    {
+        EXPECT_EQ(queue.dequeue(), i);
+        EXPECT_EQ(join_completions.load(), 0);
+        queue.task_done();
+    }
+
+    for (auto & waiter : waiters)
+    {
+        waiter.join();
+    }
+    EXPECT_EQ(join_completions.load(), num_waiters);
+    EXPECT_THROW(queue.task_done(), abc::abc_error);
+}
+
+namespace
+{
+
+// Constructor that may throw, move that does not
+struct Picky
+{
+    explicit Picky(int v) : value{ v }
+    {
+        if (v < 0)
+        {
+            throw std::invalid_argument("negative");
+        }
+    }
+
+    Picky(Picky &&) noexcept = default;
+
+    int value;
+};
+
+} // namespace
+
+TEST(async_segmented_queue, throwing_constructor_leaves_no_hole)
+{
+    using namespace abc::async;
+
+    SegmentedQueue<Picky, 2, exec::inline_scheduler> queue(exec::inline_scheduler{});
+    EXPECT_TRUE(queue.try_emplace(1));
+    EXPECT_THROW(queue.try_emplace(-1), std::invalid_argument);
+    EXPECT_TRUE(queue.try_emplace(2));
+    EXPECT_TRUE(queue.try_emplace(3));
+    EXPECT_EQ(queue.size(), 3u);
+
+    // The failed item never took a cell or a task_done() slot, not even across a segment boundary
+    for (int i = 1; i <= 3; ++i)
+    {
+        EXPECT_EQ(queue.dequeue()->value, i);
+        queue.task_done();
+    }
+    EXPECT_FALSE(queue.dequeue().has_value());
+    queue.join_blocking();
+}
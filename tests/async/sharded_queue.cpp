@@ -0,0 +1,225 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <abc/async/sharded_queue.h>
+
+#include <exec/inline_scheduler.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(async_sharded_queue, sync_enqueue_dequeue_keeps_thread_local_order)
+{
+    using namespace abc::async;
+
+    ShardedQueue<std::string, 8, exec::inline_scheduler> queue(exec::inline_scheduler{}, 4);
+    EXPECT_EQ(queue.shard_count(), 4u);
+    EXPECT_EQ(queue.capacity(), 32u);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.dequeue().has_value());
+
+    // Everything fits into the home shard, so one thread sees its own items in order
+    for (int i = 0; i < 8; ++i)
+    {
+        EXPECT_TRUE(queue.enqueue(std::to_string(i)));
+    }
+    EXPECT_EQ(queue.size(), 8u);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        EXPECT_EQ(queue.dequeue(), std::to_string(i));
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(async_sharded_queue, full_home_shard_spills_over_and_is_stolen_back)
+{
+    using namespace abc::async;
+
+    ShardedQueue<int, 4, exec::inline_scheduler> queue(exec::inline_scheduler{}, 3);
+
+    for (int i = 0; i < 12; ++i)
+    {
+        EXPECT_TRUE(queue.enqueue(i));
+    }
+    EXPECT_FALSE(queue.enqueue(12));
+    EXPECT_EQ(queue.size(), 12u);
+
+    // Items placed in other shards are only reachable by stealing
+    int sum = 0;
+    for (int i = 0; i < 12; ++i)
+    {
+        auto item = queue.dequeue();
+        ASSERT_TRUE(item.has_value());
+        sum += *item;
+    }
+    EXPECT_EQ(sum, 66);
+    EXPECT_FALSE(queue.dequeue().has_value());
+
+    // A rejected enqueue does not count as unfinished
+    for (int i = 0; i < 12; ++i)
+    {
+        queue.task_done();
+    }
+    EXPECT_THROW(queue.task_done(), abc::abc_error);
+}
+
+TEST(async_sharded_queue, consumers_steal_from_producer_shards)
+{
+    using namespace abc::async;
+    constexpr std::size_t num_producers = 4;
+    constexpr std::size_t num_consumers = 4;
+    constexpr std::size_t items_per_producer = 5000;
+
+    ShardedQueue<std::size_t, 64, exec::inline_scheduler> queue(exec::inline_scheduler{}, 8);
+    std::atomic<std::size_t> consumed_count{ 0 };
+    std::atomic<std::size_t> consumed_sum{ 0 };
+
+    std::vector<std::thread> producers;
+    for (std::size_t i = 0; i < num_producers; ++i)
+    {
+        producers.emplace_back([&]() {
+            for (std::size_t j = 1; j <= items_per_producer; ++j)
+            {
+                while (!queue.enqueue(j))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Consumers are other threads, so most of their items come from stealing
+    std::vector<std::thread> consumers;
+    for (std::size_t i = 0; i < num_consumers; ++i)
+    {
+        consumers.emplace_back([&]() {
+            while (consumed_count.load() < num_producers * items_per_producer)
+            {
+                auto item = queue.dequeue();
+                if (!item)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                consumed_sum += *item;
+                ++consumed_count;
+            }
+        });
+    }
+
+    for (auto & producer : producers)
+    {
+        producer.join();
+    }
+    for (auto & consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    EXPECT_EQ(consumed_count.load(), num_producers * items_per_producer);
+    EXPECT_EQ(consumed_sum.load(), num_producers * items_per_producer * (items_per_producer + 1) / 2);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(async_sharded_queue, async_round_trip_with_join)
+{
+    using namespace abc::async;
+    constexpr int num_items = 2000;
+
+    exec::static_thread_pool pool{ 2 };
+    ShardedQueue<int, 8, exec::static_thread_pool::scheduler> queue(pool.get_scheduler(), 2);
+    std::atomic<long> consumed_sum{ 0 };
+
+    auto producer = [&](int first) -> exec::task<void> {
+        for (int i = first; i < num_items; i += 2)
+        {
+            co_await queue.async_enqueue(i);
+        }
+    };
+
+    auto consumer = [&]() -> exec::task<void> {
+        for (int i = 0; i < num_items / 2; ++i)
+        {
+            consumed_sum += co_await queue.async_dequeue();
+            queue.task_done();
+        }
+    };
+
+    stdexec::sync_wait(stdexec::when_all(consumer(), consumer(), producer(0), producer(1), queue.join()));
+
+    EXPECT_EQ(consumed_sum.load(), static_cast<long>(num_items) * (num_items - 1) / 2);
+    EXPECT_TRUE(queue.empty());
+    queue.join_blocking();
+}
+
+TEST(async_sharded_queue, items_done_on_other_threads_release_join)
+{
+    using namespace abc::async;
+    constexpr int num_items = 64;
+    constexpr int num_workers = 4;
+
+    exec::static_thread_pool pool{ 2 };
+    ShardedQueue<int, 64, exec::static_thread_pool::scheduler> queue(pool.get_scheduler(), 4);
+    for (int i = 0; i < num_items; ++i)
+    {
+        EXPECT_TRUE(queue.enqueue(i));
+    }
+
+    // Items are tallied by the enqueuing thread's shard and marked done under other shards
+    std::atomic<int> done{ 0 };
+    std::vector<std::thread> workers;
+    for (int w = 0; w < num_workers; ++w)
+    {
+        workers.emplace_back([&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            while (queue.dequeue().has_value())
+            {
+                ++done;
+                queue.task_done();
+            }
+        });
+    }
+
+    queue.join_blocking();
+    EXPECT_EQ(done.load(), num_items);
+
+    for (auto & worker : workers)
+    {
+        worker.join();
+    }
+    EXPECT_THROW(queue.task_done(), abc::abc_error);
+}
+
+TEST(async_sharded_queue, senders_round_trip_with_backpressure)
+{
+    using namespace abc::async;
+    constexpr int num_items = 1000;
+
+    exec::static_thread_pool pool{ 2 };
+    ShardedQueue<int, 4, exec::static_thread_pool::scheduler> queue(pool.get_scheduler(), 2);
+    std::atomic<long> consumed_sum{ 0 };
+
+    auto producer = [&]() -> exec::task<void> {
+        for (int i = 0; i < num_items; ++i)
+        {
+            co_await queue.enqueue_sender(i);
+        }
+    };
+
+    auto consumer = [&]() -> exec::task<void> {
+        for (int i = 0; i < num_items; ++i)
+        {
+            consumed_sum += co_await queue.dequeue_sender();
+        }
+    };
+
+    stdexec::sync_wait(stdexec::when_all(consumer(), producer()));
+    EXPECT_EQ(consumed_sum.load(), static_cast<long>(num_items) * (num_items - 1) / 2);
+    EXPECT_TRUE(queue.empty());
+}
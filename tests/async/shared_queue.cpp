@@ -0,0 +1,285 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <abc/details/config.h>
+
+#if defined(ABC_OS_LINUX)
+
+#include <abc/async/shared_byte_ring.h>
+#include <abc/async/shared_queue.h>
+#include <abc/shared_memory.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+
+struct Item
+{
+    std::uint32_t producer;
+    std::uint32_t sequence;
+};
+
+// Runs `body` in a forked child process, which exits with 0 when it returns true
+template <typename F>
+auto
+spawn(F && body) -> pid_t
+{
+    pid_t const pid = ::fork();
+    if (pid == 0)
+    {
+        bool ok = false;
+        try
+        {
+            ok = body();
+        }
+        catch (...)
+        {
+        }
+        ::_exit(ok ? 0 : 1);
+    }
+    return pid;
+}
+
+auto
+exited_cleanly(pid_t const pid) -> bool
+{
+    int status = 0;
+    return ::waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+} // namespace
+
+TEST(async_shared_queue, create_attach_round_trip)
+{
+    using namespace abc::async;
+    using queue_type = SharedQueue<Item, 8>;
+
+    auto memory = abc::SharedMemory::anonymous(queue_type::required_size());
+    auto creator = queue_type::create(memory);
+    auto peer = queue_type::attach(memory);
+    EXPECT_TRUE(peer.empty());
+    EXPECT_FALSE(peer.dequeue().has_value());
+
+    for (std::uint32_t i = 0; i < 8; ++i)
+    {
+        EXPECT_TRUE(creator.enqueue(Item{ 1, i }));
+    }
+    EXPECT_FALSE(creator.enqueue(Item{ 1, 8 }));
+    EXPECT_EQ(peer.size(), 8u);
+
+    for (std::uint32_t i = 0; i < 8; ++i)
+    {
+        auto const item = peer.dequeue();
+        ASSERT_TRUE(item.has_value());
+        EXPECT_EQ(item->sequence, i);
+    }
+    EXPECT_TRUE(creator.empty());
+    EXPECT_FALSE(peer.dequeue_for(std::chrono::milliseconds{ 10 }).has_value());
+}
+
+TEST(async_shared_queue, attach_refuses_unready_and_mismatched_segments)
+{
+    using namespace abc::async;
+    using queue_type = SharedQueue<Item, 16>;
+
+    auto memory = abc::SharedMemory::anonymous(SharedQueue<Item, 32>::required_size());
+    try
+    {
+        queue_type::attach(memory);
+        ADD_FAILURE() << "attached to an uninitialized segment";
+    }
+    catch (abc::abc_error const & error)
+    {
+        EXPECT_EQ(error.code(), make_error_code(abc::errc::shared_memory_not_ready));
+    }
+
+    queue_type::create(memory);
+    EXPECT_NO_THROW(queue_type::attach(memory));
+    EXPECT_THROW((SharedQueue<std::uint64_t, 16>::attach(memory)), abc::abc_error);
+    EXPECT_THROW((SharedQueue<Item, 32>::attach(memory)), abc::abc_error);
+    EXPECT_THROW((SharedQueue<Item, 16, QueueCardinality::Spsc>::attach(memory)), abc::abc_error);
+    EXPECT_THROW(SharedByteRing<256>::attach(memory), abc::abc_error);
+
+    // A creator that died half-way leaves the segment marked as initializing
+    auto * header = reinterpret_cast<details::SharedRingHeader *>(memory.data());
+    header->state.store(details::SharedRingHeader::initializing);
+    try
+    {
+        queue_type::attach(memory);
+        ADD_FAILURE() << "attached to a partially initialized segment";
+    }
+    catch (abc::abc_error const & error)
+    {
+        EXPECT_EQ(error.code(), make_error_code(abc::errc::shared_memory_not_ready));
+    }
+
+    auto too_small = abc::SharedMemory::anonymous(64);
+    EXPECT_THROW(queue_type::create(too_small), abc::abc_error);
+}
+
+TEST(async_shared_queue, recreation_makes_old_handles_stale)
+{
+    using namespace abc::async;
+    using queue_type = SharedQueue<Item, 4>;
+
+    auto memory = abc::SharedMemory::anonymous(queue_type::required_size());
+    auto creator = queue_type::create(memory);
+    auto peer = queue_type::attach(memory);
+    EXPECT_FALSE(peer.stale());
+
+    std::atomic<bool> woke_with_error{ false };
+    std::thread blocked{ [&]() {
+        try
+        {
+            peer.dequeue_blocking();
+        }
+        catch (abc::abc_error const & error)
+        {
+            woke_with_error = error.code() == make_error_code(abc::errc::shared_memory_not_ready);
+        }
+    } };
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+    auto recreated = queue_type::create(memory);
+    blocked.join();
+
+    EXPECT_TRUE(woke_with_error.load());
+    EXPECT_TRUE(creator.stale());
+    EXPECT_TRUE(peer.stale());
+    EXPECT_FALSE(recreated.stale());
+    EXPECT_FALSE(queue_type::attach(memory).stale());
+}
+
+TEST(async_shared_queue, two_process_producers_consumers)
+{
+    using namespace abc::async;
+    using queue_type = SharedQueue<Item, 64>;
+    constexpr std::uint32_t num_producers = 2;
+    constexpr std::uint32_t items_per_producer = 20000;
+
+    auto memory = abc::SharedMemory::anonymous(queue_type::required_size());
+    auto queue = queue_type::create(memory);
+
+    std::vector<pid_t> producers;
+    for (std::uint32_t p = 0; p < num_producers; ++p)
+    {
+        producers.push_back(spawn([&memory, p]() {
+            auto child = queue_type::attach(memory);
+            for (std::uint32_t i = 1; i <= items_per_producer; ++i)
+            {
+                child.enqueue_blocking(Item{ p, i });
+            }
+            return true;
+        }));
+        ASSERT_GT(producers.back(), 0);
+    }
+
+    std::atomic<std::uint32_t> consumed_count{ 0 };
+    std::atomic<std::uint64_t> consumed_sum{ 0 };
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < 2; ++c)
+    {
+        consumers.emplace_back([&]() {
+            std::vector<std::uint32_t> last_seen(num_producers, 0);
+            while (true)
+            {
+                auto const item = queue.dequeue_for(std::chrono::milliseconds{ 100 });
+                if (!item)
+                {
+                    if (consumed_count.load() == num_producers * items_per_producer)
+                    {
+                        return;
+                    }
+                    continue;
+                }
+
+                // Items of one producer are seen in order
+                EXPECT_GT(item->sequence, last_seen[item->producer]);
+                last_seen[item->producer] = item->sequence;
+                consumed_sum += item->sequence;
+                ++consumed_count;
+            }
+        });
+    }
+
+    for (pid_t const pid : producers)
+    {
+        EXPECT_TRUE(exited_cleanly(pid));
+    }
+    for (auto & consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    EXPECT_EQ(consumed_count.load(), num_producers * items_per_producer);
+    EXPECT_EQ(consumed_sum.load(), std::uint64_t{ num_producers } * items_per_producer * (items_per_producer + 1) / 2);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(async_shared_queue, two_process_byte_ring)
+{
+    using namespace abc::async;
+    using ring_type = SharedByteRing<1024>;
+    constexpr std::uint32_t num_messages = 20000;
+
+    auto memory = abc::SharedMemory::anonymous(ring_type::required_size());
+    auto ring = ring_type::create(memory);
+
+    pid_t const producer = spawn([&memory]() {
+        auto child = ring_type::attach(memory);
+        std::vector<abc::byte_t> message;
+        for (std::uint32_t i = 0; i < num_messages; ++i)
+        {
+            message.assign(i % 97, static_cast<abc::byte_t>(i));
+            child.write_blocking(message);
+        }
+        return true;
+    });
+    ASSERT_GT(producer, 0);
+
+    for (std::uint32_t i = 0; i < num_messages; ++i)
+    {
+        auto const view = ring.read_blocking();
+        ASSERT_EQ(view.size(), i % 97);
+        for (abc::byte_t const byte : view)
+        {
+            ASSERT_EQ(byte, static_cast<abc::byte_t>(i));
+        }
+        ring.commit_read();
+    }
+
+    EXPECT_TRUE(exited_cleanly(producer));
+    EXPECT_TRUE(ring.empty());
+    EXPECT_FALSE(ring.read_for(std::chrono::milliseconds{ 10 }).has_value());
+}
+
+TEST(async_shared_queue, named_segment_is_shared_until_unlinked)
+{
+    using namespace abc::async;
+    using queue_type = SharedQueue<std::uint64_t, 16>;
+
+    std::string const name = "/abc_shared_queue_test_" + std::to_string(::getpid());
+    auto created = abc::SharedMemory::create(name, queue_type::required_size());
+    auto queue = queue_type::create(created);
+    EXPECT_TRUE(queue.enqueue(42));
+
+    auto opened = abc::SharedMemory::open(name);
+    EXPECT_EQ(opened.size(), created.size());
+    EXPECT_EQ(queue_type::attach(opened).dequeue(), 42u);
+
+    abc::SharedMemory::unlink(name);
+    EXPECT_THROW(abc::SharedMemory::open(name), abc::abc_error);
+}
+
+#endif // ABC_OS_LINUX
@@ -0,0 +1,175 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <abc/async/spill_queue.h>
+#include <abc/bytes.h>
+
+#include <exec/inline_scheduler.hpp>
+#include <exec/static_thread_pool.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(async_spill_queue, full_ring_spills_and_drains_in_order)
+{
+    using namespace abc::async;
+
+    SpillQueue<int, 8, exec::inline_scheduler> queue(exec::inline_scheduler{});
+    for (int i = 0; i < 100; ++i)
+    {
+        queue.enqueue(i);
+    }
+    EXPECT_EQ(queue.size(), 100u);
+
+    auto const stats = queue.spill_stats();
+    EXPECT_EQ(stats.spilled_items, 92u);
+    EXPECT_EQ(stats.spilled_bytes, 92u * sizeof(int));
+    EXPECT_EQ(stats.pending_items, 92u);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(queue.dequeue(), i);
+    }
+    EXPECT_FALSE(queue.dequeue().has_value());
+    EXPECT_TRUE(queue.empty());
+
+    auto const drained = queue.spill_stats();
+    EXPECT_EQ(drained.drained_items, 92u);
+    EXPECT_EQ(drained.drained_bytes, 92u * sizeof(int));
+    EXPECT_EQ(drained.pending_items, 0u);
+    EXPECT_EQ(drained.pending_bytes, 0u);
+    EXPECT_GE(drained.total_spill_latency, drained.max_spill_latency);
+}
+
+TEST(async_spill_queue, items_follow_the_spill_until_it_is_drained)
+{
+    using namespace abc::async;
+
+    SpillQueue<int, 4, exec::inline_scheduler> queue(exec::inline_scheduler{});
+    for (int i = 0; i < 6; ++i)
+    {
+        queue.enqueue(i);
+    }
+
+    // The ring has room again, but 4 and 5 are still spilled, so 6 must not overtake them
+    EXPECT_EQ(queue.dequeue(), 0);
+    queue.enqueue(6);
+    for (int i = 1; i < 7; ++i)
+    {
+        EXPECT_EQ(queue.dequeue(), i);
+    }
+
+    // Once drained, the ring is used directly again
+    auto const spilled = queue.spill_stats().spilled_items;
+    queue.enqueue(7);
+    EXPECT_EQ(queue.spill_stats().spilled_items, spilled);
+    EXPECT_EQ(queue.dequeue(), 7);
+}
+
+TEST(async_spill_queue, spill_file_grows_and_is_reused)
+{
+    using namespace abc::async;
+
+    // A tiny spill file has to grow, then compact as it is drained and refilled
+    SpillQueue<abc::Bytes, 4, exec::inline_scheduler> queue(exec::inline_scheduler{}, std::filesystem::temp_directory_path().string(), 64);
+    int next_in = 0;
+    int next_out = 0;
+    for (int round = 0; round < 20; ++round)
+    {
+        for (int i = 0; i < 50; ++i, ++next_in)
+        {
+            queue.enqueue(abc::Bytes::from(std::to_string(next_in) + std::string(next_in % 37, 'x')));
+        }
+        for (int i = 0; i < 40; ++i, ++next_out)
+        {
+            EXPECT_EQ(queue.dequeue(), abc::Bytes::from(std::to_string(next_out) + std::string(next_out % 37, 'x')));
+        }
+    }
+    while (auto item = queue.dequeue())
+    {
+        EXPECT_EQ(*item, abc::Bytes::from(std::to_string(next_out) + std::string(next_out % 37, 'x')));
+        ++next_out;
+    }
+    EXPECT_EQ(next_out, next_in);
+    EXPECT_EQ(queue.spill_stats().spilled_bytes, queue.spill_stats().drained_bytes);
+}
+
+TEST(async_spill_queue, concurrent_producers_never_fail_and_keep_their_order)
+{
+    using namespace abc::async;
+    constexpr int num_producers = 4;
+    constexpr int num_items = 20000;
+
+    SpillQueue<int, 64, exec::inline_scheduler, QueueCardinality::Mpsc> queue(exec::inline_scheduler{});
+    std::atomic<int> finished{ 0 };
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < num_producers; ++p)
+    {
+        producers.emplace_back([&, p]() {
+            for (int i = 0; i < num_items; ++i)
+            {
+                queue.enqueue(p * num_items + i);
+            }
+            ++finished;
+        });
+    }
+
+    std::vector<int> last(num_producers, -1);
+    int received = 0;
+    while (received < num_producers * num_items)
+    {
+        if (auto item = queue.dequeue())
+        {
+            int const producer = *item / num_items;
+            EXPECT_GT(*item % num_items, last[producer]);
+            last[producer] = *item % num_items;
+            ++received;
+        }
+    }
+    for (auto & producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_EQ(finished.load(), num_producers);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.spill_stats().spilled_items, queue.spill_stats().drained_items);
+}
+
+TEST(async_spill_queue, async_dequeue_sees_spilled_items)
+{
+    using namespace abc::async;
+    constexpr int num_items = 5000;
+
+    exec::static_thread_pool pool{ 2 };
+    SpillQueue<int, 16, exec::static_thread_pool::scheduler> queue(pool.get_scheduler());
+    std::atomic<long> consumed_sum{ 0 };
+
+    // A burst much larger than the ring, produced without ever waiting
+    auto producer = [&]() -> exec::task<void> {
+        for (int i = 0; i < num_items; ++i)
+        {
+            queue.enqueue(i);
+        }
+        co_return;
+    };
+
+    auto consumer = [&]() -> exec::task<void> {
+        int expected = 0;
+        for (int i = 0; i < num_items; ++i)
+        {
+            int const item = co_await queue.async_dequeue();
+            EXPECT_EQ(item, expected++);
+            consumed_sum += item;
+        }
+    };
+
+    stdexec::sync_wait(stdexec::when_all(consumer(), producer()));
+
+    EXPECT_EQ(consumed_sum.load(), static_cast<long>(num_items) * (num_items - 1) / 2);
+    EXPECT_TRUE(queue.empty());
+}
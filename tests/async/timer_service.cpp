@@ -0,0 +1,291 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & the contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <abc/async/queue.h>
+#include <abc/async/timer_service.h>
+
+#include <exec/task.hpp>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using namespace std::chrono_literals;
+
+enum class Completion
+{
+    None,
+    Value,
+    Stopped,
+};
+
+// How an operation completed. The receiver records it under the mutex, so that once get() or
+// wait() saw the completion, the receiver no longer touches this and it can go out of scope.
+class CompletionLog
+{
+private:
+    mutable std::mutex mutex_;
+    std::condition_variable completed_;
+    Completion completion_{ Completion::None };
+
+public:
+    auto
+    record(Completion const completion) -> void
+    {
+        std::lock_guard lock{ mutex_ };
+        completion_ = completion;
+        completed_.notify_all();
+    }
+
+    auto
+    get() const -> Completion
+    {
+        std::lock_guard lock{ mutex_ };
+        return completion_;
+    }
+
+    auto
+    wait() -> Completion
+    {
+        std::unique_lock lock{ mutex_ };
+        completed_.wait(lock, [this]() { return completion_ != Completion::None; });
+        return completion_;
+    }
+};
+
+// Receiver exposing a stop token and recording how it was completed
+struct RecordingReceiver
+{
+    using receiver_concept = stdexec::receiver_t;
+
+    struct Env
+    {
+        stdexec::inplace_stop_token token_;
+
+        auto
+        query(stdexec::get_stop_token_t) const noexcept -> stdexec::inplace_stop_token
+        {
+            return token_;
+        }
+    };
+
+    CompletionLog * completion_;
+    stdexec::inplace_stop_token token_;
+
+    auto
+    set_value() noexcept -> void
+    {
+        completion_->record(Completion::Value);
+    }
+
+    auto
+    set_stopped() noexcept -> void
+    {
+        completion_->record(Completion::Stopped);
+    }
+
+    auto
+    get_env() const noexcept -> Env
+    {
+        return Env{ token_ };
+    }
+};
+
+} // namespace
+
+TEST(async_timer_service, schedule_after_completes_on_the_service_thread_not_early)
+{
+    using namespace abc::async;
+
+    TimerService<> service;
+    auto scheduler = service.get_scheduler();
+
+    auto const start = std::chrono::steady_clock::now();
+    std::thread::id completed_on;
+    auto sleeper = [&]() -> exec::task<void> {
+        co_await schedule_after(scheduler, 20ms);
+        completed_on = std::this_thread::get_id();
+    };
+    stdexec::sync_wait(sleeper());
+
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+    EXPECT_NE(completed_on, std::this_thread::get_id());
+}
+
+TEST(async_timer_service, schedule_after_delay_counts_from_every_start)
+{
+    using namespace abc::async;
+
+    TimerService<> service;
+    auto const sender = service.get_scheduler().schedule_after(30ms);
+
+    // Made well before it is used, and used twice, as a retry loop would
+    std::this_thread::sleep_for(50ms);
+    for (int run = 0; run < 2; ++run)
+    {
+        CompletionLog completion;
+        stdexec::inplace_stop_source stop_source;
+        auto const start = std::chrono::steady_clock::now();
+        auto operation = stdexec::connect(sender, RecordingReceiver{ &completion, stop_source.get_token() });
+        stdexec::start(operation);
+
+        EXPECT_EQ(completion.wait(), Completion::Value);
+        EXPECT_GE(std::chrono::steady_clock::now() - start, 30ms);
+    }
+}
+
+TEST(async_timer_service, timers_complete_in_deadline_order)
+{
+    using namespace abc::async;
+
+    TimerService<> service;
+    auto scheduler = service.get_scheduler();
+    auto const base = std::chrono::steady_clock::now();
+
+    std::mutex mutex;
+    std::vector<int> order;
+    auto sleeper = [&](int const id, std::chrono::milliseconds const delay) -> exec::task<void> {
+        co_await schedule_at(scheduler, base + delay);
+        std::lock_guard lock{ mutex };
+        order.push_back(id);
+    };
+
+    stdexec::sync_wait(stdexec::when_all(sleeper(3, 45ms), sleeper(1, 5ms), sleeper(4, 150ms), sleeper(2, 25ms)));
+    EXPECT_EQ(order, (std::vector<int>{ 1, 2, 3, 4 }));
+}
+
+TEST(async_timer_service, sleep_for_uses_the_default_service)
+{
+    using namespace abc::async;
+
+    auto sleeper = []() -> exec::task<std::chrono::steady_clock::duration> {
+        auto const start = std::chrono::steady_clock::now();
+        co_await sleep_for(10ms);
+        co_await sleep_until(std::chrono::steady_clock::now() + 10ms);
+        co_return std::chrono::steady_clock::now() - start;
+    };
+
+    auto [elapsed] = stdexec::sync_wait(sleeper()).value();
+    EXPECT_GE(elapsed, 20ms);
+}
+
+TEST(async_timer_service, drives_queue_timeouts_on_the_same_runtime)
+{
+    using namespace abc::async;
+    using Scheduler = TimerScheduler<std::chrono::steady_clock>;
+
+    TimerService<> service;
+    Queue<int, 16, Scheduler> queue(service.get_scheduler());
+
+    auto producer = [&]() -> exec::task<void> {
+        co_await schedule_after(service.get_scheduler(), 10ms);
+        co_await queue.async_enqueue(42);
+    };
+    auto consumer = [&]() -> exec::task<int> {
+        co_return co_await queue.async_dequeue();
+    };
+
+    auto [item] = stdexec::sync_wait(stdexec::when_all(consumer(), producer())).value();
+    EXPECT_EQ(item, 42);
+}
+
+TEST(async_timer_service, stop_request_cancels_a_pending_timer)
+{
+    using namespace abc::async;
+
+    TimerService<> service;
+    stdexec::inplace_stop_source stop_source;
+    CompletionLog completion;
+
+    auto operation = stdexec::connect(service.get_scheduler().schedule_after(1h), RecordingReceiver{ &completion, stop_source.get_token() });
+    stdexec::start(operation);
+    std::this_thread::sleep_for(5ms);
+    EXPECT_EQ(completion.get(), Completion::None);
+
+    stop_source.request_stop();
+    EXPECT_EQ(completion.wait(), Completion::Stopped);
+}
+
+TEST(async_timer_service, already_stopped_token_completes_inline)
+{
+    using namespace abc::async;
+
+    TimerService<> service;
+    stdexec::inplace_stop_source stop_source;
+    stop_source.request_stop();
+    CompletionLog completion;
+
+    auto operation = stdexec::connect(service.get_scheduler().schedule(), RecordingReceiver{ &completion, stop_source.get_token() });
+    stdexec::start(operation);
+    EXPECT_EQ(completion.get(), Completion::Stopped);
+}
+
+TEST(async_timer_service, destruction_stops_pending_timers)
+{
+    using namespace abc::async;
+
+    stdexec::inplace_stop_source stop_source;
+    CompletionLog completion;
+    {
+        TimerService<> service;
+        auto operation = stdexec::connect(service.get_scheduler().schedule_after(1h), RecordingReceiver{ &completion, stop_source.get_token() });
+        stdexec::start(operation);
+    }
+    EXPECT_EQ(completion.get(), Completion::Stopped);
+}
+
+TEST(async_timer_service, racing_stop_requests_complete_every_timer_once)
+{
+    using namespace abc::async;
+    constexpr int num_timers = 2000;
+
+    TimerService<> service{ std::chrono::microseconds{ 100 } };
+    std::vector<stdexec::inplace_stop_source> stop_sources(num_timers);
+    std::vector<CompletionLog> completions(num_timers);
+
+    using operation_type = stdexec::connect_result_t<TimerScheduler<std::chrono::steady_clock>::sender_type, RecordingReceiver>;
+    std::vector<std::optional<operation_type>> operations(num_timers);
+
+    struct Connect
+    {
+        TimerScheduler<std::chrono::steady_clock> scheduler;
+        std::chrono::microseconds delay;
+        RecordingReceiver receiver;
+
+        operator operation_type() const
+        {
+            return stdexec::connect(scheduler.schedule_after(delay), receiver);
+        }
+    };
+
+    for (int i = 0; i < num_timers; ++i)
+    {
+        operations[i].emplace(Connect{ service.get_scheduler(), std::chrono::microseconds{ i % 500 }, RecordingReceiver{ &completions[i], stop_sources[i].get_token() } });
+        stdexec::start(*operations[i]);
+    }
+
+    // Stops race with expiry, every operation still completes exactly once
+    std::thread stopper{ [&]() {
+        for (int i = 0; i < num_timers; i += 2)
+        {
+            stop_sources[i].request_stop();
+        }
+    } };
+    stopper.join();
+
+    for (int i = 0; i < num_timers; ++i)
+    {
+        Completion const completion = completions[i].wait();
+        if (i % 2 == 1)
+        {
+            EXPECT_EQ(completion, Completion::Value);
+        }
+    }
+}
@@ -0,0 +1,106 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & abc contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <abc/deadline_alarm.h>
+
+#include <asio/error.hpp>
+#include <asio/io_context.hpp>
+#include <asio/strand.hpp>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST(deadline_alarm, fires_at_the_absolute_expiry)
+{
+    asio::io_context io_context;
+    abc::deadline_alarm alarm{ io_context.get_executor() };
+
+    auto const expiry = abc::deadline_alarm::clock_type::now() + 300us;
+    std::error_code result{ make_error_code(std::errc::timed_out) };
+    abc::deadline_alarm::clock_type::time_point fired{};
+    alarm.expires_at(expiry);
+    alarm.async_wait([&](std::error_code const & ec) {
+        result = ec;
+        fired = abc::deadline_alarm::clock_type::now();
+    });
+
+    io_context.run_for(1s);
+    EXPECT_FALSE(result);
+    EXPECT_GE(fired, expiry);
+}
+
+TEST(deadline_alarm, past_expiry_fires_right_away)
+{
+    asio::io_context io_context;
+    abc::deadline_alarm alarm{ io_context.get_executor() };
+
+    int fired = 0;
+    alarm.expires_at(abc::deadline_alarm::clock_type::time_point{});
+    alarm.async_wait([&](std::error_code const & ec) {
+        EXPECT_FALSE(ec);
+        ++fired;
+    });
+
+    io_context.run_for(100ms);
+    EXPECT_EQ(fired, 1);
+}
+
+TEST(deadline_alarm, cancel_aborts_the_wait_and_the_alarm_can_be_rearmed)
+{
+    asio::io_context io_context;
+    abc::deadline_alarm alarm{ io_context.get_executor() };
+
+    std::error_code first{};
+    alarm.expires_at(abc::deadline_alarm::clock_type::now() + 1h);
+    alarm.async_wait([&](std::error_code const & ec) { first = ec; });
+    alarm.cancel();
+    io_context.run_for(50ms);
+    EXPECT_EQ(first, asio::error::operation_aborted);
+
+    int fired = 0;
+    alarm.expires_at(abc::deadline_alarm::clock_type::now() + 1ms);
+    alarm.async_wait([&](std::error_code const & ec) {
+        EXPECT_FALSE(ec);
+        ++fired;
+    });
+    io_context.restart();
+    io_context.run_for(1s);
+    EXPECT_EQ(fired, 1);
+}
+
+TEST(deadline_alarm, past_expiries_are_not_lost_on_a_multithreaded_io_context)
+{
+    constexpr int num_waits = 2000;
+
+    asio::io_context io_context;
+    auto strand = asio::make_strand(io_context);
+    abc::deadline_alarm alarm{ strand };
+
+    // Re-armed in the past from its own handler, the way timer_driver re-arms its reap alarm
+    int fired = 0;
+    std::function<void(std::error_code const &)> on_expiry = [&](std::error_code const & ec) {
+        EXPECT_FALSE(ec);
+        if (++fired < num_waits) {
+            alarm.expires_at(abc::deadline_alarm::clock_type::time_point{});
+            alarm.async_wait(on_expiry);
+        }
+    };
+    alarm.expires_at(abc::deadline_alarm::clock_type::time_point{});
+    alarm.async_wait(on_expiry);
+
+    // A lost expiry leaves the chain waiting and the threads running out the clock
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&io_context]() { io_context.run_for(10s); });
+    }
+    for (auto & thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(fired, num_waits);
+}
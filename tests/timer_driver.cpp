@@ -0,0 +1,424 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & abc contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <abc/timer_driver.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using namespace std::chrono_literals;
+
+// Runs `io_context` until `done` holds or a generous timeout passes
+template <typename Predicate>
+auto
+run_until(asio::io_context & io_context, Predicate done) -> bool
+{
+    auto const give_up = std::chrono::steady_clock::now() + 5s;
+    while (!done() && std::chrono::steady_clock::now() < give_up)
+    {
+        io_context.run_for(5ms);
+    }
+    return done();
+}
+
+} // namespace
+
+TEST(timer_driver, cancelled_timer_never_fires)
+{
+    asio::io_context io_context;
+    auto driver = std::make_shared<abc::timer_driver>(&io_context, 1ms);
+    driver->start();
+
+    int fired = 0;
+    int cancelled_fired = 0;
+    auto const cancelled = driver->schedule(10ms, [&](std::error_code const &) { ++cancelled_fired; });
+    driver->schedule(20ms, [&](std::error_code const & ec) {
+        EXPECT_FALSE(ec);
+        ++fired;
+    });
+    EXPECT_EQ(driver->pending(), 2u);
+
+    EXPECT_TRUE(driver->cancel(cancelled));
+    EXPECT_EQ(driver->pending(), 1u);
+    EXPECT_FALSE(driver->cancel(cancelled));
+
+    EXPECT_TRUE(run_until(io_context, [&] { return fired == 1; }));
+    EXPECT_EQ(cancelled_fired, 0);
+    driver->stop();
+}
+
+TEST(timer_driver, handles_go_stale_when_slots_are_reused)
+{
+    asio::io_context io_context;
+    auto driver = std::make_shared<abc::timer_driver>(&io_context, 1ms);
+    driver->start();
+
+    auto const first = driver->schedule(1h, [](std::error_code const &) {});
+    EXPECT_TRUE(driver->cancel(first));
+
+    // The next reap recycles the cancelled entry; its slot is reused under a new generation
+    io_context.run_for(20ms);
+    auto const second = driver->schedule(1h, [](std::error_code const &) {});
+    EXPECT_EQ(second.slot, first.slot);
+    EXPECT_NE(second, first);
+    EXPECT_FALSE(driver->cancel(first));
+    EXPECT_FALSE(driver->reschedule(first, 1ms));
+    EXPECT_FALSE(driver->cancel(abc::timer_handle{}));
+    EXPECT_EQ(driver->pending(), 1u);
+
+    EXPECT_TRUE(driver->cancel(second));
+    EXPECT_EQ(driver->pending(), 0u);
+    driver->stop();
+}
+
+TEST(timer_driver, reschedule_moves_the_deadline)
+{
+    asio::io_context io_context;
+    auto driver = std::make_shared<abc::timer_driver>(&io_context, 1ms);
+    driver->start();
+
+    std::vector<int> order;
+    auto const postponed = driver->schedule(1ms, [&](std::error_code const &) { order.push_back(1); });
+    driver->schedule(30ms, [&](std::error_code const &) { order.push_back(2); });
+    auto const hastened = driver->schedule(1h, [&](std::error_code const &) { order.push_back(3); });
+
+    EXPECT_TRUE(driver->reschedule(postponed, 60ms));
+    EXPECT_TRUE(driver->reschedule(hastened, 0ms));
+
+    EXPECT_TRUE(run_until(io_context, [&] { return order.size() == 3; }));
+    EXPECT_EQ(order, (std::vector<int>{ 3, 2, 1 }));
+
+    // Fired timers cannot be moved any more
+    EXPECT_FALSE(driver->reschedule(postponed, 1ms));
+    driver->stop();
+}
+
+TEST(timer_driver, stop_aborts_pending_timers)
+{
+    asio::io_context io_context;
+    auto driver = std::make_shared<abc::timer_driver>(&io_context, 1ms);
+    driver->start();
+
+    bool aborted = false;
+    auto const handle = driver->schedule(1h, [&](std::error_code const & ec) { aborted = ec == asio::error::operation_aborted; });
+    driver->stop();
+    EXPECT_FALSE(driver->schedule(1ms, [](std::error_code const &) {}));
+
+    // Aborted by the next reap
+    EXPECT_TRUE(run_until(io_context, [&] { return aborted; }));
+    EXPECT_FALSE(driver->cancel(handle));
+    EXPECT_EQ(driver->pending(), 0u);
+}
+
+TEST(timer_driver, stop_aborts_pending_timers_before_the_reap_interval)
+{
+    asio::io_context io_context;
+    auto driver = std::make_shared<abc::timer_driver>(&io_context, 1h);
+    driver->start();
+
+    bool aborted = false;
+    driver->schedule(1h, [&](std::error_code const & ec) { aborted = ec == asio::error::operation_aborted; });
+    io_context.run_for(5ms);
+
+    // The reap chain sleeps for an hour, stop() wakes it up
+    auto const stopped_at = std::chrono::steady_clock::now();
+    driver->stop();
+    EXPECT_TRUE(run_until(io_context, [&] { return aborted; }));
+    EXPECT_LT(std::chrono::steady_clock::now() - stopped_at, 1s);
+}
+
+TEST(timer_driver, concurrent_schedule_and_cancel)
+{
+    constexpr int num_threads = 4;
+    constexpr int timers_per_thread = 20000;
+
+    asio::io_context io_context;
+    auto work = asio::make_work_guard(io_context);
+    auto driver = std::make_shared<abc::timer_driver>(&io_context, 1ms);
+    driver->start();
+    std::thread reaper{ [&io_context] { io_context.run(); } };
+
+    // Every other timer is cancelled, moved or left to fire
+    std::atomic<int> fired{ 0 };
+    std::atomic<int> cancelled{ 0 };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < timers_per_thread; ++i)
+            {
+                auto const handle = driver->schedule(std::chrono::milliseconds{ i % 5 }, [&](std::error_code const & ec) {
+                    EXPECT_FALSE(ec);
+                    ++fired;
+                });
+                if (i % 3 == 0 && driver->cancel(handle))
+                {
+                    ++cancelled;
+                }
+                else if (i % 3 == 1)
+                {
+                    driver->reschedule(handle, 2ms);
+                }
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    auto const give_up = std::chrono::steady_clock::now() + 10s;
+    while (fired + cancelled < num_threads * timers_per_thread && std::chrono::steady_clock::now() < give_up)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_EQ(fired + cancelled, num_threads * timers_per_thread);
+    EXPECT_EQ(driver->pending(), 0u);
+
+    driver->stop();
+    work.reset();
+    io_context.stop();
+    reaper.join();
+}
+
+TEST(timer_driver, periodic_timer_reuses_its_handle_until_cancelled)
+{
+    asio::io_context io_context;
+    auto driver = std::make_shared<abc::timer_driver>(&io_context, 1ms);
+    driver->start();
+
+    int fired = 0;
+    abc::timer_handle handle;
+    handle = driver->schedule_periodic(2ms, [&](std::error_code const & ec) {
+        EXPECT_FALSE(ec);
+        if (++fired == 5)
+        {
+            EXPECT_TRUE(driver->cancel(handle));
+        }
+    });
+    EXPECT_EQ(driver->pending(), 1u);
+
+    EXPECT_TRUE(run_until(io_context, [&] { return fired == 5; }));
+    io_context.run_for(20ms);
+    EXPECT_EQ(fired, 5);
+    EXPECT_EQ(driver->pending(), 0u);
+    EXPECT_FALSE(driver->cancel(handle));
+    driver->stop();
+}
+
+TEST(timer_driver, cancel_waits_for_a_running_periodic_callback)
+{
+    asio::io_context io_context;
+    auto driver = std::make_shared<abc::timer_driver>(&io_context, 1ms);
+    driver->start();
+
+    std::atomic<int> entered{ 0 };
+    std::atomic<int> returned{ 0 };
+    auto const handle = driver->schedule_periodic(2ms, [&](std::error_code const &) {
+        ++entered;
+        std::this_thread::sleep_for(20ms);
+        ++returned;
+    });
+
+    std::thread reaper{ [&]() { run_until(io_context, [&] { return driver->pending() == 0; }); } };
+    while (entered.load() == 0)
+    {
+        std::this_thread::yield();
+    }
+
+    // Caught mid-callback: cancel() returns once it is over, and nothing fires after that
+    EXPECT_TRUE(driver->cancel(handle));
+    int const fired = returned.load();
+    EXPECT_EQ(entered.load(), fired);
+    reaper.join();
+    io_context.restart();
+    io_context.run_for(10ms);
+    EXPECT_EQ(entered.load(), fired);
+    driver->stop();
+}
+
+TEST(timer_driver, fire_all_catches_up_on_every_missed_period)
+{
+    asio::io_context io_context;
+    auto driver = std::make_shared<abc::timer_driver>(&io_context, 1ms);
+    driver->start();
+
+    // The first callback overruns by several periods, which the next reap makes up for at once
+    std::vector<std::chrono::steady_clock::time_point> firings;
+    driver->schedule_periodic(
+        10ms,
+        [&](std::error_code const &) {
+            firings.push_back(std::chrono::steady_clock::now());
+            if (firings.size() == 1)
+            {
+                std::this_thread::sleep_for(45ms);
+            }
+        },
+        abc::timer_mode::fixed_rate,
+        abc::catch_up_policy::fire_all);
+
+    EXPECT_TRUE(run_until(io_context, [&] { return firings.size() >= 5; }));
+    EXPECT_LT(firings[4] - firings[1], 5ms);
+    driver->stop();
+}
+
+TEST(timer_driver, skip_fires_once_after_an_overrun)
+{
+    asio::io_context io_context;
+    auto driver = std::make_shared<abc::timer_driver>(&io_context, 1ms);
+    driver->start();
+
+    std::vector<std::chrono::steady_clock::time_point> firings;
+    driver->schedule_periodic(
+        10ms,
+        [&](std::error_code const &) {
+            firings.push_back(std::chrono::steady_clock::now());
+            if (firings.size() == 1)
+            {
+                std::this_thread::sleep_for(45ms);
+            }
+        },
+        abc::timer_mode::fixed_rate,
+        abc::catch_up_policy::skip);
+
+    EXPECT_TRUE(run_until(io_context, [&] { return firings.size() >= 3; }));
+
+    // The overdue period fires once and missed ones are dropped: the next firing waits for the
+    // original schedule, about 5ms after the overrun, instead of following right away
+    EXPECT_GE(firings[2] - firings[1], 2ms);
+    driver->stop();
+}
+
+TEST(timer_driver, fixed_delay_counts_from_the_end_of_the_callback)
+{
+    asio::io_context io_context;
+    auto driver = std::make_shared<abc::timer_driver>(&io_context, 1ms);
+    driver->start();
+
+    std::vector<std::chrono::steady_clock::time_point> starts;
+    std::vector<std::chrono::steady_clock::time_point> ends;
+    driver->schedule_periodic(
+        10ms,
+        [&](std::error_code const &) {
+            starts.push_back(std::chrono::steady_clock::now());
+            std::this_thread::sleep_for(5ms);
+            ends.push_back(std::chrono::steady_clock::now());
+        },
+        abc::timer_mode::fixed_delay);
+
+    EXPECT_TRUE(run_until(io_context, [&] { return starts.size() >= 4; }));
+    for (std::size_t i = 1; i < starts.size(); ++i)
+    {
+        // Ticks are whole milliseconds, so allow one for rounding
+        EXPECT_GE(starts[i] - ends[i - 1], 9ms);
+    }
+    driver->stop();
+}
+
+TEST(timer_driver, slack_timers_fire_within_their_window)
+{
+    asio::io_context io_context;
+    auto driver = std::make_shared<abc::timer_driver>(&io_context, 1s);
+    driver->start();
+
+    constexpr int timer_count = 64;
+    std::vector<std::chrono::steady_clock::time_point> earliest(timer_count);
+    std::vector<std::chrono::steady_clock::time_point> fired(timer_count);
+    int fired_count = 0;
+    for (int i = 0; i < timer_count; ++i)
+    {
+        auto const delay = 20ms + std::chrono::milliseconds{i % 16};
+        earliest[i] = std::chrono::steady_clock::now() + delay;
+        driver->schedule(
+            delay,
+            [&, i](std::error_code const & ec) {
+                EXPECT_FALSE(ec);
+                fired[i] = std::chrono::steady_clock::now();
+                ++fired_count;
+            },
+            32ms);
+    }
+
+    EXPECT_TRUE(run_until(io_context, [&] { return fired_count == timer_count; }));
+    for (int i = 0; i < timer_count; ++i)
+    {
+        EXPECT_GE(fired[i], earliest[i]);
+    }
+
+    // 16 distinct deadlines share a handful of expiry ticks
+    EXPECT_GE(driver->wakeups_avoided(), 8u);
+    driver->stop();
+}
+
+TEST(timer_driver, earlier_deadline_wakes_a_sleeping_driver)
+{
+    asio::io_context io_context;
+    auto driver = std::make_shared<abc::timer_driver>(&io_context, 10s);
+    driver->start();
+    driver->schedule(1h, [](std::error_code const &) {});
+
+    // Let the chain go to sleep for the full interval before scheduling the short timer
+    io_context.run_for(20ms);
+    auto const scheduled = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point fired{};
+    driver->schedule(5ms, [&](std::error_code const &) { fired = std::chrono::steady_clock::now(); });
+
+    EXPECT_TRUE(run_until(io_context, [&] { return fired != std::chrono::steady_clock::time_point{}; }));
+    EXPECT_LT(fired - scheduled, 1s);
+    driver->stop();
+}
+
+TEST(timer_driver, idle_driver_sleeps_until_the_next_deadline)
+{
+    asio::io_context io_context;
+    auto driver = std::make_shared<abc::timer_driver>(&io_context, 10s);
+    driver->start();
+
+    int fired = 0;
+    driver->schedule(50ms, [&](std::error_code const &) { ++fired; });
+    EXPECT_TRUE(run_until(io_context, [&] { return fired == 1; }));
+
+    // One reap to start, at most a couple more around the deadline; none polling in between
+    EXPECT_LE(driver->wakeups(), 4u);
+    driver->stop();
+}
+
+TEST(timer_driver, sub_millisecond_deadlines_fire_in_order)
+{
+    asio::io_context io_context;
+    auto driver = std::make_shared<abc::timer_driver>(&io_context, 100ms, 1us);
+    driver->start();
+    EXPECT_EQ(driver->resolution(), 1us);
+
+    std::vector<int> order;
+    std::vector<std::chrono::steady_clock::time_point> earliest;
+    std::vector<std::chrono::steady_clock::time_point> fired;
+    for (int const delay_us : {600, 200, 400, 800})
+    {
+        auto const delay = std::chrono::microseconds{delay_us};
+        earliest.push_back(std::chrono::steady_clock::now() + delay);
+        driver->schedule(delay, [&, delay_us](std::error_code const &) {
+            order.push_back(delay_us);
+            fired.push_back(std::chrono::steady_clock::now());
+        });
+    }
+
+    EXPECT_TRUE(run_until(io_context, [&] { return order.size() == 4; }));
+    EXPECT_EQ(order, (std::vector<int>{ 200, 400, 600, 800 }));
+    std::sort(earliest.begin(), earliest.end());
+    for (std::size_t i = 0; i < fired.size(); ++i)
+    {
+        EXPECT_GE(fired[i], earliest[i]);
+    }
+    driver->stop();
+}
@@ -0,0 +1,204 @@
+// Copyright(c) 2025 - present, Payton Wu (payton.wu@outlook.com) & abc contributors.
+// Distributed under the MIT License (http://opensource.org/licenses/MIT)
+
+#include <abc/timing_wheel.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+struct test_timer : abc::timing_wheel_node
+{
+    int id{ 0 };
+};
+
+auto
+collect(abc::timing_wheel & wheel, std::uint64_t const target) -> std::vector<int>
+{
+    std::vector<int> fired;
+    wheel.advance(target, [&fired](abc::timing_wheel_node * node) { fired.push_back(static_cast<test_timer *>(node)->id); });
+    return fired;
+}
+
+} // namespace
+
+TEST(timing_wheel, fires_in_expiry_order)
+{
+    abc::timing_wheel wheel;
+    std::vector<test_timer> timers(5);
+    std::uint64_t const expiries[] = { 30, 5, 5000, 64, 63 };
+    for (int i = 0; i < 5; ++i)
+    {
+        timers[i].id = i;
+        wheel.insert(&timers[i], expiries[i]);
+    }
+    EXPECT_EQ(wheel.size(), 5u);
+
+    EXPECT_TRUE(collect(wheel, 4).empty());
+    EXPECT_EQ(collect(wheel, 64), (std::vector<int>{ 1, 0, 4, 3 }));
+    EXPECT_EQ(wheel.now(), 64u);
+    EXPECT_EQ(collect(wheel, 10000), (std::vector<int>{ 2 }));
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(timing_wheel, cascades_across_every_level)
+{
+    abc::timing_wheel wheel{ 12345 };
+    std::vector<test_timer> timers(10);
+    for (int i = 0; i < 10; ++i)
+    {
+        timers[i].id = i;
+        wheel.insert(&timers[i], 12345 + (std::uint64_t{ 1 } << (6 * i)) + static_cast<std::uint64_t>(i));
+    }
+
+    for (int i = 0; i < 10; ++i)
+    {
+        std::uint64_t const expiry = timers[i].expiry;
+        EXPECT_TRUE(collect(wheel, expiry - 1).empty()) << i;
+        EXPECT_EQ(collect(wheel, expiry), (std::vector<int>{ i }));
+    }
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(timing_wheel, erase_unlinks_without_firing)
+{
+    abc::timing_wheel wheel;
+    test_timer a;
+    test_timer b;
+    a.id = 1;
+    b.id = 2;
+    wheel.insert(&a, 100);
+    wheel.insert(&b, 100);
+    EXPECT_TRUE(a.linked());
+
+    wheel.erase(&a);
+    EXPECT_FALSE(a.linked());
+    EXPECT_EQ(wheel.size(), 1u);
+    EXPECT_EQ(collect(wheel, 200), (std::vector<int>{ 2 }));
+    EXPECT_FALSE(b.linked());
+}
+
+TEST(timing_wheel, next_wakeup_is_never_after_the_first_expiry)
+{
+    abc::timing_wheel wheel{ 1000 };
+    EXPECT_EQ(wheel.next_wakeup(), std::numeric_limits<std::uint64_t>::max());
+
+    test_timer near_timer;
+    test_timer far_timer;
+    wheel.insert(&far_timer, 1000 + 100000);
+    EXPECT_LE(wheel.next_wakeup(), 1000u + 100000u);
+    EXPECT_GT(wheel.next_wakeup(), 1000u);
+
+    wheel.insert(&near_timer, 1010);
+    EXPECT_EQ(wheel.next_wakeup(), 1010u);
+
+    // Already due
+    test_timer late_timer;
+    wheel.insert(&late_timer, 10);
+    EXPECT_EQ(wheel.next_wakeup(), 1000u);
+}
+
+TEST(timing_wheel, callback_may_reinsert)
+{
+    abc::timing_wheel wheel;
+    test_timer periodic;
+    int fired = 0;
+    wheel.insert(&periodic, 10);
+
+    wheel.advance(100, [&](abc::timing_wheel_node * node) {
+        ++fired;
+        wheel.insert(node, node->expiry + 10);
+    });
+    EXPECT_EQ(fired, 10);
+    EXPECT_EQ(periodic.expiry, 110u);
+    EXPECT_TRUE(periodic.linked());
+}
+
+TEST(timing_wheel, clear_keeps_the_current_tick)
+{
+    abc::timing_wheel wheel{ 50 };
+    std::vector<test_timer> timers(3);
+    wheel.insert(&timers[0], 10);
+    wheel.insert(&timers[1], 60);
+    wheel.insert(&timers[2], 1u << 20);
+
+    EXPECT_EQ(wheel.clear([](abc::timing_wheel_node * node) { EXPECT_FALSE(node->linked()); }), 3u);
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(wheel.now(), 50u);
+}
+
+TEST(timing_wheel, matches_a_sorted_reference)
+{
+    constexpr int num_timers = 20000;
+
+    std::mt19937_64 rng{ 2025 };
+    abc::timing_wheel wheel{ 777 };
+    std::vector<test_timer> timers(num_timers);
+    std::vector<std::pair<std::uint64_t, int>> expected;
+    for (int i = 0; i < num_timers; ++i)
+    {
+        timers[i].id = i;
+        std::uint64_t const delay = rng() >> (rng() % 64);
+        std::uint64_t const expiry = delay > std::numeric_limits<std::uint64_t>::max() - 777 ? 777 : 777 + delay;
+        wheel.insert(&timers[i], expiry);
+        if (i % 7 == 0)
+        {
+            wheel.erase(&timers[i]);
+        }
+        else
+        {
+            expected.emplace_back(expiry, i);
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<std::uint64_t> fired_expiries;
+    std::uint64_t previous_now = wheel.now();
+    wheel.advance(std::numeric_limits<std::uint64_t>::max(), [&](abc::timing_wheel_node * node) {
+        // Never early, and at the expiry itself unless it was already due
+        EXPECT_EQ(wheel.now(), std::max(node->expiry, previous_now));
+        previous_now = wheel.now();
+        fired_expiries.push_back(node->expiry);
+    });
+
+    ASSERT_EQ(fired_expiries.size(), expected.size());
+    for (std::size_t i = 0; i != expected.size(); ++i)
+    {
+        EXPECT_EQ(fired_expiries[i], expected[i].first);
+    }
+}
+
+TEST(timing_wheel, coalesce_picks_the_roundest_tick_in_the_window)
+{
+    EXPECT_EQ(abc::timing_wheel::coalesce(100, 0), 100u);
+    EXPECT_EQ(abc::timing_wheel::coalesce(100, 10), 104u);
+    EXPECT_EQ(abc::timing_wheel::coalesce(100, 28), 128u);
+    EXPECT_EQ(abc::timing_wheel::coalesce(0, 5), 0u);
+    EXPECT_EQ(abc::timing_wheel::coalesce(std::numeric_limits<std::uint64_t>::max() - 1, 100), std::numeric_limits<std::uint64_t>::max() - 1);
+
+    // Overlapping windows land on one tick
+    std::mt19937_64 rng{ 24 };
+    for (int i = 0; i < 10000; ++i)
+    {
+        std::uint64_t const deadline = rng() >> 20;
+        std::uint64_t const slack = rng() % 100000;
+        std::uint64_t const coalesced = abc::timing_wheel::coalesce(deadline, slack);
+        EXPECT_GE(coalesced, deadline);
+        EXPECT_LE(coalesced, deadline + slack);
+    }
+
+    std::vector<std::uint64_t> ticks;
+    for (std::uint64_t deadline = 30000; deadline < 30100; ++deadline)
+    {
+        ticks.push_back(abc::timing_wheel::coalesce(deadline, 1000));
+    }
+    std::sort(ticks.begin(), ticks.end());
+    EXPECT_LE(std::unique(ticks.begin(), ticks.end()) - ticks.begin(), 2);
+}